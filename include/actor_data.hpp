@@ -301,8 +301,14 @@ namespace actor_data
 
 extern ActorData data[(size_t)ActorId::END];
 
+// Loads the monster definitions from the binary database, which is regenerated
+// from monsters.xml if it is missing or does not match the xml file
 void init();
 
+// Parses and checks monsters.xml, and writes the binary database if there are
+// no errors (used by the "--validate-data" command line option)
+bool validate_data();
+
 void save();
 void load();
 
@@ -9,6 +9,8 @@
 #include "sound.hpp"
 #include "spells.hpp"
 
+struct LosResult;
+
 struct AiAttData
 {
         Wpn* wpn = nullptr;
@@ -43,6 +45,10 @@ public:
         bool can_see_actor(const Actor& other,
                            const bool hard_blocked_los[map_w][map_h]) const;
 
+        // Same as above, but with the line of sight to the other actor already
+        // checked by the caller (e.g. cached for several monsters)
+        bool can_see_actor(const Actor& other, const LosResult& los) const;
+
         std::vector<Actor*> seen_actors() const override;
 
         std::vector<Actor*> seen_foes() const override;
@@ -125,6 +131,11 @@ protected:
         bool is_actor_seeable(const Actor& other,
                               const bool hard_blocked_los[map_w][map_h]) const;
 
+        bool is_actor_seeable(const Actor& other, const LosResult& los) const;
+
+        // Whether the monster notices an actor which is possible to see
+        bool is_noticing_seeable_actor(const Actor& other) const;
+
         void make_leader_aware_silent() const;
 
         void print_player_see_mon_become_aware_msg() const;
@@ -0,0 +1,64 @@
+#ifndef AREA_QUERY_HPP
+#define AREA_QUERY_HPP
+
+#include <vector>
+
+#include "global.hpp"
+#include "rl_utils.hpp"
+
+class Actor;
+
+// Actors indexed by map position, built in one pass over all actors - for
+// effects which visit many cells and need to know who is standing there
+// (e.g. explosions), instead of searching the actor list for each cell
+class ActorGrid
+{
+public:
+        ActorGrid();
+
+        Actor* living_actor(const P& p) const
+        {
+                return living_actors_[p.x][p.y];
+        }
+
+        // Visits the corpses at the position, in the order of the actor list
+        template<typename Func>
+        void for_each_corpse(const P& p, Func func) const
+        {
+                for (int idx = corpse_head_[p.x][p.y];
+                     idx != -1;
+                     idx = corpse_next_[idx])
+                {
+                        func(corpses_[idx]);
+                }
+        }
+
+private:
+        Actor* living_actors_[map_w][map_h];
+
+        // Index of the first corpse at each position (or -1), the corpses at
+        // the same position are linked by "corpse_next_"
+        int corpse_head_[map_w][map_h];
+
+        std::vector<Actor*> corpses_;
+
+        std::vector<int> corpse_next_;
+};
+
+namespace area_query
+{
+
+// Returns the cells in the area which can be reached by a line from the origin
+// without passing a blocked cell, grouped by king distance to the origin (the
+// origin itself is at index 0, if not blocked)
+std::vector< std::vector<P> > cells_in_los(
+        const R& area,
+        const P& origin,
+        const bool blocked[map_w][map_h]);
+
+// Living actors within the given king distance of the origin
+std::vector<Actor*> living_actors_within(const P& origin, const int radi);
+
+} // area_query
+
+#endif // AREA_QUERY_HPP
@@ -1,55 +1,167 @@
 #ifndef COLORS_HPP
 #define COLORS_HPP
 
+#include <cstdint>
 #include <string>
+#include <type_traits>
 
 #include <SDL_video.h>
 
 //-----------------------------------------------------------------------------
 // Color
 //-----------------------------------------------------------------------------
+// NOTE: This is kept as a plain four byte value (no user defined copying or
+// destructor), since colors are copied for every cell and text drawn
 class Color
 {
 public:
-        Color();
+        constexpr Color() :
+                r_              (0),
+                g_              (0),
+                b_              (0),
+                is_defined_     (false) {}
 
-        Color(uint8_t r, uint8_t g, uint8_t b);
+        constexpr Color(const uint8_t r, const uint8_t g, const uint8_t b) :
+                r_              (r),
+                g_              (g),
+                b_              (b),
+                is_defined_     (true) {}
 
-        Color(const SDL_Color& sdl_color);
+        Color(const SDL_Color& sdl_color) :
+                r_              (sdl_color.r),
+                g_              (sdl_color.g),
+                b_              (sdl_color.b),
+                is_defined_     (true) {}
 
-        ~Color();
+        bool operator==(const Color other) const
+        {
+                return
+                        (r_ == other.r_) &&
+                        (g_ == other.g_) &&
+                        (b_ == other.b_);
+        }
 
-        Color& operator=(const Color& other);
+        bool operator!=(const Color other) const
+        {
+                return !(*this == other);
+        }
 
-        bool operator==(const Color& other) const;
+        Color fraction(const double div) const;
 
-        bool operator!=(const Color& other) const;
+        bool is_defined() const
+        {
+                return is_defined_;
+        }
 
-        Color fraction(const double div);
+        void clear()
+        {
+                *this = Color();
+        }
 
-        bool is_defined() const;
+        SDL_Color sdl_color() const
+        {
+                return {r_, g_, b_, 0};
+        }
 
-        void clear();
+        uint8_t r() const
+        {
+                return r_;
+        }
 
-        SDL_Color sdl_color() const;
+        uint8_t g() const
+        {
+                return g_;
+        }
 
-        uint8_t r() const;
-        uint8_t g() const;
-        uint8_t b() const;
+        uint8_t b() const
+        {
+                return b_;
+        }
 
-        void set_r(const uint8_t value);
-        void set_g(const uint8_t value);
-        void set_b(const uint8_t value);
+        void set_r(const uint8_t value)
+        {
+                r_ = value;
+        }
 
-private:
-        SDL_Color sdl_color_;
+        void set_g(const uint8_t value)
+        {
+                g_ = value;
+        }
+
+        void set_b(const uint8_t value)
+        {
+                b_ = value;
+        }
 
+private:
+        uint8_t r_;
+        uint8_t g_;
+        uint8_t b_;
         bool is_defined_;
 };
 
+static_assert(std::is_trivially_copyable<Color>::value &&
+              (sizeof(Color) == 4),
+              "Color should be a plain four byte value");
+
+// Index of each named color in the palette
+enum class ColorId
+{
+        // Defined in colors.xml
+        black,
+        extra_dark_gray,
+        dark_gray,
+        gray,
+        white,
+        light_white,
+        red,
+        light_red,
+        dark_green,
+        green,
+        light_green,
+        dark_yellow,
+        yellow,
+        blue,
+        light_blue,
+        magenta,
+        light_magenta,
+        cyan,
+        light_cyan,
+        brown,
+        dark_brown,
+        gray_brown,
+        dark_gray_brown_brown,
+        violet,
+        dark_violet,
+        orange,
+        sepia,
+        light_sepia,
+        dark_sepia,
+        teal,
+        light_teal,
+        dark_teal,
+
+        // GUI colors, set to one of the colors above in colors_gui.xml
+        text,
+        menu_highlight,
+        menu_dark,
+        title,
+        msg_good,
+        msg_bad,
+        msg_note,
+        mon_unaware_bg,
+        mon_allied_bg,
+        mon_temp_property_bg,
+
+        END
+};
+
 namespace colors
 {
 
+// Set up from the color definition files on init
+extern Color palette[(size_t)ColorId::END];
+
 void init();
 
 Color name_to_color(const std::string& name);
@@ -59,52 +171,218 @@ std::string color_to_name(const Color& color);
 //-----------------------------------------------------------------------------
 // Available colors
 //-----------------------------------------------------------------------------
-Color black();
-Color extra_dark_gray();
-Color dark_gray();
-Color gray();
-Color white();
-Color light_white();
-Color red();
-Color light_red();
-Color dark_green();
-Color green();
-Color light_green();
-Color dark_yellow();
-Color yellow();
-Color blue();
-Color light_blue();
-Color magenta();
-Color light_magenta();
-Color cyan();
-Color light_cyan();
-Color brown();
-Color dark_brown();
-Color gray_brown();
-Color dark_gray_brown_brown();
-Color violet();
-Color dark_violet();
-Color orange();
-Color sepia();
-Color light_sepia();
-Color dark_sepia();
-Color teal();
-Color light_teal();
-Color dark_teal();
+inline Color black()
+{
+        return palette[(size_t)ColorId::black];
+}
+
+inline Color extra_dark_gray()
+{
+        return palette[(size_t)ColorId::extra_dark_gray];
+}
+
+inline Color dark_gray()
+{
+        return palette[(size_t)ColorId::dark_gray];
+}
+
+inline Color gray()
+{
+        return palette[(size_t)ColorId::gray];
+}
+
+inline Color white()
+{
+        return palette[(size_t)ColorId::white];
+}
+
+inline Color light_white()
+{
+        return palette[(size_t)ColorId::light_white];
+}
+
+inline Color red()
+{
+        return palette[(size_t)ColorId::red];
+}
+
+inline Color light_red()
+{
+        return palette[(size_t)ColorId::light_red];
+}
+
+inline Color dark_green()
+{
+        return palette[(size_t)ColorId::dark_green];
+}
+
+inline Color green()
+{
+        return palette[(size_t)ColorId::green];
+}
+
+inline Color light_green()
+{
+        return palette[(size_t)ColorId::light_green];
+}
+
+inline Color dark_yellow()
+{
+        return palette[(size_t)ColorId::dark_yellow];
+}
+
+inline Color yellow()
+{
+        return palette[(size_t)ColorId::yellow];
+}
+
+inline Color blue()
+{
+        return palette[(size_t)ColorId::blue];
+}
+
+inline Color light_blue()
+{
+        return palette[(size_t)ColorId::light_blue];
+}
+
+inline Color magenta()
+{
+        return palette[(size_t)ColorId::magenta];
+}
+
+inline Color light_magenta()
+{
+        return palette[(size_t)ColorId::light_magenta];
+}
+
+inline Color cyan()
+{
+        return palette[(size_t)ColorId::cyan];
+}
+
+inline Color light_cyan()
+{
+        return palette[(size_t)ColorId::light_cyan];
+}
+
+inline Color brown()
+{
+        return palette[(size_t)ColorId::brown];
+}
+
+inline Color dark_brown()
+{
+        return palette[(size_t)ColorId::dark_brown];
+}
+
+inline Color gray_brown()
+{
+        return palette[(size_t)ColorId::gray_brown];
+}
+
+inline Color dark_gray_brown_brown()
+{
+        return palette[(size_t)ColorId::dark_gray_brown_brown];
+}
+
+inline Color violet()
+{
+        return palette[(size_t)ColorId::violet];
+}
+
+inline Color dark_violet()
+{
+        return palette[(size_t)ColorId::dark_violet];
+}
+
+inline Color orange()
+{
+        return palette[(size_t)ColorId::orange];
+}
+
+inline Color sepia()
+{
+        return palette[(size_t)ColorId::sepia];
+}
+
+inline Color light_sepia()
+{
+        return palette[(size_t)ColorId::light_sepia];
+}
+
+inline Color dark_sepia()
+{
+        return palette[(size_t)ColorId::dark_sepia];
+}
+
+inline Color teal()
+{
+        return palette[(size_t)ColorId::teal];
+}
+
+inline Color light_teal()
+{
+        return palette[(size_t)ColorId::light_teal];
+}
+
+inline Color dark_teal()
+{
+        return palette[(size_t)ColorId::dark_teal];
+}
 
 //-----------------------------------------------------------------------------
 // GUI colors (using the colors above)
 //-----------------------------------------------------------------------------
-Color text();
-Color menu_highlight();
-Color menu_dark();
-Color title();
-Color msg_good();
-Color msg_bad();
-Color msg_note();
-Color mon_unaware_bg();
-Color mon_allied_bg();
-Color mon_temp_property_bg();
+inline Color text()
+{
+        return palette[(size_t)ColorId::text];
+}
+
+inline Color menu_highlight()
+{
+        return palette[(size_t)ColorId::menu_highlight];
+}
+
+inline Color menu_dark()
+{
+        return palette[(size_t)ColorId::menu_dark];
+}
+
+inline Color title()
+{
+        return palette[(size_t)ColorId::title];
+}
+
+inline Color msg_good()
+{
+        return palette[(size_t)ColorId::msg_good];
+}
+
+inline Color msg_bad()
+{
+        return palette[(size_t)ColorId::msg_bad];
+}
+
+inline Color msg_note()
+{
+        return palette[(size_t)ColorId::msg_note];
+}
+
+inline Color mon_unaware_bg()
+{
+        return palette[(size_t)ColorId::mon_unaware_bg];
+}
+
+inline Color mon_allied_bg()
+{
+        return palette[(size_t)ColorId::mon_allied_bg];
+}
+
+inline Color mon_temp_property_bg()
+{
+        return palette[(size_t)ColorId::mon_temp_property_bg];
+}
 
 } // colors
 
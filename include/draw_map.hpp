@@ -10,6 +10,17 @@ struct CellRenderData;
 namespace draw_map
 {
 
+// Counters for verifying how much map drawing is saved by only redrawing cells
+// which changed since the previous frame
+struct Stats
+{
+        int nr_cells_drawn_last_frame = 0;
+
+        // Totals since the last call to "reset_stats"
+        long nr_frames = 0;
+        long nr_cells_drawn = 0;
+};
+
 void clear();
 
 void run();
@@ -18,6 +29,10 @@ const CellRenderData& get_drawn_cell(int x, int y);
 
 const CellRenderData& get_drawn_cell_player_memory(int x, int y);
 
+const Stats& stats();
+
+void reset_stats();
+
 } // draw_map
 
 #endif // DRAW_MAP_HPP
@@ -1,7 +1,6 @@
 #ifndef FEATURE_DATA_HPP
 #define FEATURE_DATA_HPP
 
-#include <functional>
 #include "gfx.hpp"
 #include "map_patterns.hpp"
 #include "property_data.hpp"
@@ -58,31 +57,33 @@ class Actor;
 class MoveRules
 {
 public:
-    MoveRules()
-    {
-        reset();
-    }
-
-    ~MoveRules() {}
+    constexpr MoveRules() :
+        can_move_common_(false),
+        props_allow_move_(),
+        nr_props_allow_move_(0) {}
 
-    void reset()
+    constexpr void reset()
     {
         can_move_common_ = false;
 
-        props_allow_move_.clear();
+        nr_props_allow_move_ = 0;
     }
 
-    void set_prop_can_move(const PropId id)
+    // NOTE: Exceeding the capacity is a compile time error, since the feature
+    // data is set up in a constant expression
+    constexpr void set_prop_can_move(const PropId id)
     {
-        props_allow_move_.push_back(id);
+        props_allow_move_[nr_props_allow_move_] = id;
+
+        ++nr_props_allow_move_;
     }
 
-    void set_can_move_common()
+    constexpr void set_can_move_common()
     {
         can_move_common_ = true;
     }
 
-    bool can_move_common() const
+    constexpr bool can_move_common() const
     {
         return can_move_common_;
     }
@@ -90,42 +91,45 @@ public:
     bool can_move(const Actor& actor) const;
 
 private:
+    static const size_t max_nr_props_allow_move = 4;
+
     bool can_move_common_;
-    std::vector<PropId> props_allow_move_;
+    PropId props_allow_move_[max_nr_props_allow_move];
+    size_t nr_props_allow_move_;
 };
 
 class Feature;
 
+// NOTE: This is a literal type, the data for all features is a table built at
+// compile time (see feature_data.cpp)
 struct FeatureData
 {
-    std::function<Feature*(const P& p)> make_obj;
-    FeatureId id;
-    char character;
-    TileId tile;
-    MoveRules move_rules;
-    bool is_sound_passable;
-    bool is_projectile_passable;
-    bool is_los_passable;
-    bool is_smoke_passable;
-    bool can_have_blood;
-    bool can_have_gore;
-    bool can_have_corpse;
-    bool can_have_rigid;
-    bool can_have_item;
-    bool is_bottomless;
-    Matl matl_type;
-    std::string msg_on_player_blocked;
-    std::string msg_on_player_blocked_blind;
-    int dodge_modifier;
-    int shock_when_adjacent;
-    FeaturePlacement auto_spawn_placement;
+    Feature* (*make_obj)(const P& p) = nullptr;
+    FeatureId id = FeatureId::END;
+    char character = ' ';
+    TileId tile = TileId::empty;
+    MoveRules move_rules = MoveRules();
+    bool is_sound_passable = true;
+    bool is_projectile_passable = true;
+    bool is_los_passable = true;
+    bool is_smoke_passable = true;
+    bool can_have_blood = true;
+    bool can_have_gore = false;
+    bool can_have_corpse = true;
+    bool can_have_rigid = true;
+    bool can_have_item = true;
+    bool is_bottomless = false;
+    Matl matl_type = Matl::stone;
+    const char* msg_on_player_blocked = "The way is blocked.";
+    const char* msg_on_player_blocked_blind = "I bump into something.";
+    int dodge_modifier = 0;
+    int shock_when_adjacent = 0;
+    FeaturePlacement auto_spawn_placement = FeaturePlacement::either;
 };
 
 namespace feature_data
 {
 
-void init();
-
 const FeatureData& data(const FeatureId id);
 
 } // feature_data
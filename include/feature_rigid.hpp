@@ -64,6 +64,13 @@ public:
 
     virtual ~Rigid() {}
 
+    // There is a rigid in every map cell, and all of them are replaced when a
+    // map is built - they are allocated from a pool of fixed size blocks, so
+    // that the rigids of a map are mostly contiguous in memory
+    static void* operator new(const size_t size);
+
+    static void operator delete(void* const ptr, const size_t size);
+
     virtual FeatureId id() const override = 0;
 
     virtual std::string name(const Article article) const override = 0;
@@ -28,6 +28,11 @@ void tick(const int speed_pct_diff = 0);
 
 int turn_nr();
 
+// Increased each time all actors have been given the chance to act once (and
+// when the actor list is reset), never reset - this can be used for data which
+// is shared by all actors acting in the same round
+int actor_round_nr();
+
 Actor* current_actor();
 
 void mobs_at_pos(const P& pos, std::vector<Mob*>& vector_ref);
@@ -1,6 +1,7 @@
 #ifndef HIGHSCORE_HPP
 #define HIGHSCORE_HPP
 
+#include <cstdint>
 #include <vector>
 #include <string>
 
@@ -91,6 +92,13 @@ private:
         Bg bg_;
 };
 
+// Position of an entry in the highscore log
+struct HighscoreIdxEntry
+{
+        int score;
+        uint32_t offset;
+};
+
 namespace highscore
 {
 
@@ -103,8 +111,18 @@ HighscoreEntry make_entry_from_current_game_data(
         const std::string game_summary_file_path,
         const IsWin is_win);
 
+// The entries are stored in an append-only log, with a separate index sorted
+// by score (which is rebuilt from the log if missing or out of date)
 void append_entry_to_highscores_file(const HighscoreEntry& entry);
 
+// Highest score first - only the index is read, not the entries themselves
+std::vector<HighscoreIdxEntry> read_index();
+
+// Reads the entries in the index range (inclusive) from the log
+std::vector<HighscoreEntry> read_entries(
+        const std::vector<HighscoreIdxEntry>& index,
+        const Range& idx_range);
+
 std::vector<HighscoreEntry> entries_sorted();
 
 } // highscore
@@ -114,7 +132,9 @@ class BrowseHighscore: public State
 public:
         BrowseHighscore() :
                 State(),
-                entries_(),
+                index_(),
+                page_(),
+                page_idx_range_(),
                 browser_() {}
 
         void on_start() override;
@@ -126,13 +146,20 @@ public:
         bool draw_overlayed() const override
         {
                 // If there are no entries, we draw an overlayed popup
-                return entries_.empty();
+                return index_.empty();
         }
 
         StateId id() override;
 
 private:
-        std::vector<HighscoreEntry> entries_;
+        // Reads the entries shown on screen, if not already read
+        void read_page();
+
+        std::vector<HighscoreIdxEntry> index_;
+
+        std::vector<HighscoreEntry> page_;
+
+        Range page_idx_range_;
 
         MenuBrowser browser_;
 };
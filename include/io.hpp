@@ -16,6 +16,20 @@ struct CellRenderData
 {
         CellRenderData& operator=(const CellRenderData&) = default;
 
+        bool operator==(const CellRenderData& other) const
+        {
+                return
+                        (tile == other.tile) &&
+                        (character == other.character) &&
+                        (color == other.color) &&
+                        (color_bg == other.color_bg);
+        }
+
+        bool operator!=(const CellRenderData& other) const
+        {
+                return !(*this == other);
+        }
+
         TileId tile = TileId::empty;
         char character = 0;
         Color color = colors::black();
@@ -60,16 +74,38 @@ struct PxRect
         R value = R();
 };
 
+enum class AllowFrameSkip
+{
+        no,
+        yes
+};
+
 namespace io
 {
 
 void init();
 void cleanup();
 
-void update_screen();
+// Presents the rendered frame. While fast-forwarding (see
+// sdl_base::is_fast_forward), frames are skipped unless "no" is given.
+void update_screen(const AllowFrameSkip allow_frame_skip = AllowFrameSkip::yes);
 
 void clear_screen();
 
+// The map layer is an off-screen surface which keeps its content between
+// frames, so that only map cells which changed need to be drawn again. While
+// the map layer is active (between "begin_map_layer" and "end_map_layer"), all
+// drawing functions write to the map layer instead of the screen.
+// NOTE: "begin_map_layer" returns false if the layer content is not retained
+// from a previous frame (e.g. if io was just initialized) - the caller must
+// then redraw every cell.
+bool begin_map_layer();
+
+void end_map_layer();
+
+// Copy the map panel area of the map layer to the screen
+void blit_map_layer();
+
 // Scale from cell coordinate(s) to screen pixel coordinate(s)
 int to_px_x(const int value);
 int to_px_y(const int value);
@@ -84,36 +120,36 @@ void draw_symbol(
         const char character,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg = colors::black());
+        const Color color,
+        const Color color_bg = colors::black());
 
 void draw_tile(
         const TileId tile,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg = colors::black());
+        const Color color,
+        const Color color_bg = colors::black());
 
 void draw_character(
         const char character,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg = colors::black());
+        const Color color,
+        const Color color_bg = colors::black());
 
 void draw_text(
         const std::string& str,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg = colors::black());
+        const Color color,
+        const Color color_bg = colors::black());
 
 int draw_text_center(
         const std::string& str,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg = colors::black(),
+        const Color color,
+        const Color color_bg = colors::black(),
         const bool is_pixel_pos_adj_allowed = true);
 
 void cover_cell(const Panel panel, const P offset);
@@ -127,36 +163,36 @@ void cover_area(const Panel panel, const P offset, const P dims);
 void draw_rectangle_solid(
         const PxPos px_pos,
         const PxPos px_dims,
-        const Color& color);
+        const Color color);
 
 void draw_line_hor(
         const PxPos px_pos,
         const int px_w,
-        const Color& color);
+        const Color color);
 
 void draw_line_ver(
         const PxPos px_pos,
         const int px_h,
-        const Color& color);
+        const Color color);
 
 void draw_blast_at_field(
         const P center_pos,
         const int radius,
         bool forbidden_cells[map_w][map_h],
-        const Color& color_inner,
-        const Color& color_outer);
+        const Color color_inner,
+        const Color color_outer);
 
 void draw_blast_at_cells(
         const std::vector<P>& positions,
-        const Color& color);
+        const Color color);
 
 void draw_blast_at_seen_cells(
         const std::vector<P>& positions,
-        const Color& color);
+        const Color color);
 
 void draw_blast_at_seen_actors(
         const std::vector<Actor*>& actors,
-        const Color& color);
+        const Color color);
 
 void draw_main_menu_logo(const int y_pos);
 
@@ -165,7 +201,7 @@ void draw_skull(const P pos);
 void draw_box(
         const R& area,
         const Panel panel = Panel::screen,
-        const Color& color = colors::dark_gray(),
+        const Color color = colors::dark_gray(),
         const bool do_cover_area = false);
 
 // Draws a description "box" for items, spells, etc. The parameter lines may be
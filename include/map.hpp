@@ -2,6 +2,7 @@
 #define MAP_HPP
 
 #include <vector>
+#include <bitset>
 
 #include "colors.hpp"
 #include "item_data.hpp"
@@ -34,18 +35,37 @@ struct ChokePointData
     ChokePointData() :
         p(),
         player_side(-1),
-        stairs_side(-1)
+        stairs_side(-1),
+        sides() {}
+
+    static size_t cell_idx(const P& pos)
+    {
+        return (pos.x * map_h) + pos.y;
+    }
+
+    bool is_on_side(const int side_idx, const P& pos) const
+    {
+        return sides[side_idx][cell_idx(pos)];
+    }
+
+    // Returns -1 if the position is on neither side (e.g. a wall, the choke
+    // point itself, or a part of the map not connected to the choke point)
+    int side_of(const P& pos) const
     {
-        sides[0].resize(0);
-        sides[1].resize(0);
+        for (int side_idx = 0; side_idx < 2; ++side_idx)
+        {
+            if (is_on_side(side_idx, pos))
+            {
+                return side_idx;
+            }
+        }
+
+        return -1;
     }
 
-    ChokePointData& operator=(const ChokePointData& other)
+    size_t nr_cells_on_side(const int side_idx) const
     {
-        p           = other.p;
-        sides[0]    = other.sides[0];
-        sides[1]    = other.sides[1];
-        return *this;
+        return sides[side_idx].count();
     }
 
     P p;
@@ -54,7 +74,9 @@ struct ChokePointData
     int player_side;
     int stairs_side;
 
-    std::vector<P> sides[2];
+    // One bit per map cell (in the same order as the map arrays), set for all
+    // cells on each side of the choke point
+    std::bitset<nr_map_cells> sides[2];
 };
 
 namespace map
@@ -91,10 +113,25 @@ void reset();
 
 Rigid* put(Rigid* const rigid);
 
+// Incremented every time a rigid is put on the map (or the map is reset) -
+// caches of data derived from the terrain can compare against this to find out
+// when they must be rebuilt.
+// NOTE: State changes of existing rigids (e.g. doors opening) are not counted.
+int terrain_revision();
+
 // This should be called when e.g. a door closes, or a wall is destoyed -
 // updates light map, player fov (etc).
 void update_vision();
 
+// Marks the vision as stale instead of updating it immediately, so that many
+// requests in a row (e.g. several monsters noticing the player, or properties
+// toggled on a group of actors) only cost one update. Stale vision is updated
+// before it is read by the player's actor visibility checks, monster LOS
+// checks, and drawing - and at the latest when the current actor's turn ends.
+void request_vision_update();
+
+void update_vision_if_stale();
+
 void make_blood(const P& origin);
 void make_gore(const P& origin);
 
@@ -92,14 +92,77 @@ void register_room(Room& room);
 
 void make_floor(const Room& room);
 
+//------------------------------------------------------------------------------
+// Connectivity tracking
+//------------------------------------------------------------------------------
+// Keeps track of which free cells (doors counted as free) are connected to
+// each other, using a disjoint set forest. While an object of this class
+// exists, map::put updates it incrementally - carving out a cell only needs
+// to merge the sets of its neighbours, so checking if the whole map is
+// connected is just a check of the number of sets. Placing blocking terrain
+// may split a set, which cannot be done incrementally, so this instead marks
+// the sets to be rebuilt on the next query.
+class FreeCellConnectivity
+{
+public:
+        FreeCellConnectivity();
+
+        ~FreeCellConnectivity();
+
+        FreeCellConnectivity(const FreeCellConnectivity&) = delete;
+
+        FreeCellConnectivity& operator=(const FreeCellConnectivity&) = delete;
+
+        // Called by map::put
+        void on_rigid_put(const P& p);
+
+        bool is_all_connected();
+
+private:
+        void rebuild();
+
+        void add_free_cell(const int idx);
+
+        int find_root(int idx);
+
+        void unite(const int idx_1, const int idx_2);
+
+        static int pos_to_idx(const P& p)
+        {
+                return (p.x * map_h) + p.y;
+        }
+
+        FreeCellConnectivity* prev_active_;
+
+        // Parent index for free cells, -1 for blocked cells
+        int parent_[nr_map_cells];
+
+        int nr_sets_;
+
+        bool is_stale_;
+};
+
+// The most recently created connectivity tracker (if any)
+extern FreeCellConnectivity* active_connectivity;
+
 //------------------------------------------------------------------------------
 // Misc utils
 //------------------------------------------------------------------------------
 void connect_rooms();
 
+// Cheap check (a single flood fill) that all walkable cells are reachable from
+// each other, doors are considered passable
+bool is_all_rooms_connected();
+
 void valid_corridor_entries(const Room& room,
                             std::vector<P>& out);
 
+// Finds all choke points among the candidate positions, with a single pass
+// over the map (appended to the output vector)
+void find_choke_points(const bool blocked[map_w][map_h],
+                       const bool candidates[map_w][map_h],
+                       std::vector<ChokePointData>& out);
+
 bool is_choke_point(const P& p,
                     const bool blocked[map_w][map_h],
                     ChokePointData* out);
@@ -9,51 +9,120 @@
 #include "global.hpp"
 #include "info_screen_state.hpp"
 
+// The text is owned by the message log, which stores each distinct text once -
+// so messages are cheap to copy, and repeated messages share the same text
 class Msg
 {
 public:
-        Msg(const std::string& text,
+        Msg(const std::string* const text,
             const Color& color_id,
             const int x_pos) :
                 color_(color_id),
                 x_pos_(x_pos),
-                str_(text),
-                repeats_str_(""),
+                text_(text),
                 nr_(1) {}
 
-        Msg() :
-                color_(colors::white()),
-                x_pos_(0),
-                str_(""),
-                repeats_str_(""),
-                nr_(1) {}
+        const std::string& text() const
+        {
+                return *text_;
+        }
+
+        int nr_repeats() const
+        {
+                return nr_;
+        }
+
+        // Length of the text with the repeats (e.g. "(x2)")
+        int len() const
+        {
+                int len = text_->size();
+
+                if (nr_ > 1)
+                {
+                        len += 3 + std::to_string(nr_).size();
+                }
+
+                return len;
+        }
 
         void str_with_repeats(std::string& str_ref) const
         {
-                str_ref = str_ + (nr_ > 1 ? repeats_str_ : "");
+                str_ref = *text_;
+
+                if (nr_ > 1)
+                {
+                        str_ref += "(x" + std::to_string(nr_) + ")";
+                }
         }
 
         void str_raw(std::string& str_ref) const
         {
-                str_ref = str_;
+                str_ref = *text_;
         }
 
         void incr_repeat()
         {
                 ++nr_;
+        }
 
-                repeats_str_ = "(x" + std::to_string(nr_) + ")";
+        // Used by the message log when moving the texts it owns
+        void set_text(const std::string* const text)
+        {
+                text_ = text;
         }
 
         Color color_;
         int x_pos_;
 
 private:
-        std::string str_;
-        std::string repeats_str_;
+        const std::string* text_;
         int nr_;
 };
 
+// Read-only view of the message history, oldest line first - the lines are
+// not copied, so the view is only valid until the log changes
+class MsgHistory
+{
+public:
+        MsgHistory() :
+                ring_           (nullptr),
+                ring_capacity_  (0),
+                first_idx_      (0),
+                size_           (0) {}
+
+        MsgHistory(const std::vector<Msg>* const ring,
+                   const size_t ring_capacity,
+                   const size_t first_idx,
+                   const size_t size) :
+                ring_           (ring),
+                ring_capacity_  (ring_capacity),
+                first_idx_      (first_idx),
+                size_           (size) {}
+
+        size_t size() const
+        {
+                return size_;
+        }
+
+        bool empty() const
+        {
+                return size_ == 0;
+        }
+
+        const std::vector<Msg>& operator[](const size_t idx) const
+        {
+                ASSERT(idx < size_);
+
+                return ring_[(first_idx_ + idx) % ring_capacity_];
+        }
+
+private:
+        const std::vector<Msg>* ring_;
+        size_t ring_capacity_;
+        size_t first_idx_;
+        size_t size_;
+};
+
 namespace msg_log
 {
 
@@ -75,7 +144,7 @@ void clear();
 
 void add_line_to_history(const std::string& line_to_add);
 
-const std::vector< std::vector<Msg> > history();
+MsgHistory history();
 
 } // log
 
@@ -112,7 +181,7 @@ private:
         int top_line_nr_;
         int btm_line_nr_;
 
-        std::vector< std::vector<Msg> > history_;
+        MsgHistory history_;
 };
 
 #endif // MSG_LOG_HPP
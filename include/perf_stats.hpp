@@ -0,0 +1,77 @@
+#ifndef PERF_STATS_HPP
+#define PERF_STATS_HPP
+
+#include <chrono>
+#include <cstdint>
+
+// Parts of the game loop which are measured
+enum class PerfCounter
+{
+        tick,
+        mon_act,
+        update_fov,
+        update_light_map,
+        snd_emit,
+        pathfind,
+        draw_map,
+        update_screen,
+        END
+};
+
+namespace perf_stats
+{
+
+// When enabled, the time spent in each counter is summed up per standard turn,
+// shown as an overlay with rolling percentiles over the most recent turns, and
+// logged to a CSV file (one line per turn)
+extern bool is_enabled;
+
+void toggle();
+
+void add(const PerfCounter counter, const int64_t duration_ns);
+
+// Called when a standard turn ends
+void end_turn();
+
+void draw();
+
+// Measures the time until the object is destroyed (nothing is measured if the
+// stats are disabled)
+class Measure
+{
+public:
+        Measure(const PerfCounter counter) :
+                counter_        (counter),
+                is_measuring_   (is_enabled)
+        {
+                if (is_measuring_)
+                {
+                        start_ = std::chrono::steady_clock::now();
+                }
+        }
+
+        ~Measure()
+        {
+                if (is_measuring_)
+                {
+                        const auto d = std::chrono::steady_clock::now() - start_;
+
+                        add(counter_,
+                            std::chrono::duration_cast<
+                                    std::chrono::nanoseconds>(d).count());
+                }
+        }
+
+        Measure(const Measure&) = delete;
+
+        Measure& operator=(const Measure&) = delete;
+
+private:
+        const PerfCounter counter_;
+        const bool is_measuring_;
+        std::chrono::steady_clock::time_point start_;
+};
+
+} // perf_stats
+
+#endif // PERF_STATS_HPP
@@ -4,6 +4,7 @@
 #include <string>
 
 #include "property_handler.hpp"
+#include "property_factory.hpp"
 #include "global.hpp"
 
 // -----------------------------------------------------------------------------
@@ -59,6 +60,12 @@ public:
 
         virtual ~Prop() {}
 
+        // Properties are allocated from pools of fixed size blocks, since they
+        // are created and destroyed very frequently
+        static void* operator new(const size_t size);
+
+        static void operator delete(void* const ptr, const size_t size);
+
         virtual void save() const {}
 
         virtual void load() {}
@@ -288,6 +295,7 @@ protected:
 
         const PropId id_;
         const PropData& data_;
+        const PropHooks& hooks_;
 
         int nr_turns_left_;
 
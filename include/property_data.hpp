@@ -167,50 +167,33 @@ enum class PropAlignment
     neutral
 };
 
+// NOTE: This is a literal type, the data for all properties is a table built at
+// compile time (see property_data.cpp)
 struct PropData
 {
-    PropData() :
-        id(PropId::END),
-        std_rnd_turns(Range(10, 10)),
-        name(""),
-        name_short(""),
-        descr(""),
-        msg_start_player(""),
-        msg_start_mon(""),
-        msg_end_player(""),
-        msg_end_mon(""),
-        msg_res_player(""),
-        msg_res_mon(""),
-        is_making_mon_aware(false),
-        allow_display_turns(true),
-        update_vision_on_toggled(false),
-        allow_test_on_bot(false),
-        alignment(PropAlignment::neutral) {}
-
-    PropId id;
-    Range std_rnd_turns;
-    std::string name;
-    std::string name_short;
-    std::string descr;
-    std::string msg_start_player;
-    std::string msg_start_mon;
-    std::string msg_end_player;
-    std::string msg_end_mon;
-    std::string msg_res_player;
-    std::string msg_res_mon;
-    bool is_making_mon_aware;
-    bool allow_display_turns;
-    bool update_vision_on_toggled;
-    bool allow_test_on_bot;
-    PropAlignment alignment;
+    PropId id = PropId::END;
+    Range std_rnd_turns = Range(10, 10);
+    const char* name = "";
+    const char* name_short = "";
+    const char* descr = "";
+    const char* msg_start_player = "";
+    const char* msg_start_mon = "";
+    const char* msg_end_player = "";
+    const char* msg_end_mon = "";
+    const char* msg_res_player = "";
+    const char* msg_res_mon = "";
+    bool is_making_mon_aware = false;
+    bool allow_display_turns = true;
+    bool update_vision_on_toggled = false;
+    bool allow_test_on_bot = false;
+    PropAlignment alignment = PropAlignment::neutral;
 };
 
 namespace property_data
 {
 
-extern PropData data[(size_t)PropId::END];
-
-void init();
+// Indexed by PropId
+extern const PropData* const data;
 
 } // prop_data
 
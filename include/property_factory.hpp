@@ -1,15 +1,33 @@
 #ifndef PROPERTY_FACTORY_H
 #define PROPERTY_FACTORY_H
 
+#include <bitset>
+
 #include "property_data.hpp"
 
 class Prop;
 
+// Property hooks which are only called for the property types overriding them
+// (most property types only implement a few of the hooks, if any)
+enum class PropHook
+{
+    on_tick,
+    on_std_turn,
+    on_act,
+    is_finished,
+    END
+};
+
+typedef std::bitset<(size_t)PropHook::END> PropHooks;
+
 namespace property_factory
 {
 
 Prop* make(const PropId id);
 
+// Which hooks the property class used for the given id implements
+const PropHooks& hooks(const PropId id);
+
 } // prop_factory
 
 #endif // PROPERTY_FACTORY_H
@@ -1,9 +1,11 @@
 #ifndef PROPERTY_HANDLER_HPP
 #define PROPERTY_HANDLER_HPP
 
+#include <memory>
 #include <string>
 
 #include "property_data.hpp"
+#include "property_factory.hpp"
 #include "global.hpp"
 #include "ability_values.hpp"
 #include "rl_utils.hpp"
@@ -175,6 +177,10 @@ private:
         // properties are currently active (see the "has_prop()" method above).
         int prop_count_cache_[(size_t)PropId::END];
 
+        // Number of active properties implementing each hook, so that hooks
+        // which no active property implements can be skipped altogether
+        int hook_count_cache_[(size_t)PropHook::END];
+
         Actor* owner_;
 };
 
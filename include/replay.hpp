@@ -0,0 +1,58 @@
+#ifndef REPLAY_HPP
+#define REPLAY_HPP
+
+#include <cstdint>
+#include <string>
+
+struct InputData;
+
+// Recording and playback of game sessions. A replay file contains the random
+// seed of the session, and every input returned by io::get (which covers both
+// game commands and all menus, prompts, etc). Since the game state only
+// depends on the seed and the input, playing back a replay reproduces the
+// session exactly.
+//
+// NOTE: The session must be played back with the same game version, the same
+// options, and the same saved game (if the session loaded one).
+//
+// While playing back, no delays are made and the screen is not updated, so the
+// session runs at maximum speed.
+
+enum class ReplayEnd
+{
+        // When the recorded input runs out, continue with live input
+        continue_live,
+
+        // When the recorded input runs out, report and exit the game (the
+        // states are unwound, so the game is cleaned up as usual)
+        quit
+};
+
+namespace replay
+{
+
+// Returns false if the file could not be opened
+bool start_recording(const std::string& path, const uint32_t seed);
+
+// Reads the replay file and seeds the random number generator, returns false
+// if the file could not be read
+bool start_playing(const std::string& path, const ReplayEnd on_end);
+
+void cleanup();
+
+bool is_playing();
+
+// True when playback has ended, and the replay was started with
+// "ReplayEnd::quit" - no more input is read, and the main loop exits
+bool is_quit_requested();
+
+// Serves the next recorded input while playing back - returns false when
+// there is no recorded input left (playback has then ended)
+bool try_get_input(InputData& input);
+
+// Called with each input read from the player (written if recording)
+void on_input(const InputData& input);
+
+} // replay
+
+#endif // REPLAY_HPP
@@ -12,6 +12,14 @@ void init();
 
 void cleanup();
 
+// True when animations and delays should be skipped, and frames should only be
+// presented once per state cycle (i.e. once per player turn during the game) or
+// when waiting for input. This is the case while the bot or a replay is playing,
+// in turbo mode, and while an Alt key is held.
+bool is_fast_forward();
+
+// Does nothing while fast-forwarding (and stops early if fast-forwarding starts
+// during the delay, e.g. by holding Alt)
 void sleep(const Uint32 duration);
 
 }
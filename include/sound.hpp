@@ -138,8 +138,16 @@ private:
 namespace snd_emit
 {
 
+// The player hears the sound immediately, while propagation to monsters is
+// deferred until "run_pending_snds" is called (at the end of the atomic turn),
+// so that all sounds emitted during one action are handled in one pass
 void run(Snd snd);
 
+void run_pending_snds();
+
+// Discard sounds which have not yet been propagated (e.g. on leaving the map)
+void clear_pending_snds();
+
 void reset_nr_snd_msg_printed_current_turn();
 
 } // snd_emit
@@ -11,7 +11,14 @@ namespace text_format
 // with the given maximum width. If any single word in the "line" parameter is
 // longer than the maximum width, we do not bother to split that word (the
 // entire word is simply added to the output vector, breaking the maximum width).
-std::vector<std::string> split(std::string line, const int max_w);
+// Runs of spaces between words are replaced by a single space.
+std::vector<std::string> split(const std::string& line, const int max_w);
+
+// Same as "split", but the result is kept in a small cache of recently used
+// texts - for text which is wrapped again every time it is drawn.
+// NOTE: The returned reference is only valid until the next call.
+const std::vector<std::string>& split_cached(const std::string& line,
+                                             const int max_w);
 
 std::vector<std::string> space_separated_list(const std::string& line);
 
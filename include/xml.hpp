@@ -14,11 +14,11 @@ void load_file(const std::string& path, Doc& to_doc);
 
 Element* first_child(Doc& doc);
 
-Element* first_child(Element* e, const std::string name = "");
+Element* first_child(Element* e, const char* const name = nullptr);
 
-bool has_child(Element* e, const std::string name);
+bool has_child(Element* e, const char* const name);
 
-Element* next_sibling(Element* e, const std::string name = "");
+Element* next_sibling(Element* e, const char* const name = nullptr);
 
 std::string get_text_str(const Element* const e);
 
@@ -26,20 +26,20 @@ bool get_text_bool(const Element* const e);
 
 int get_text_int(const Element* const e);
 
-std::string get_attribute_str(const Element* const e, const std::string name);
+std::string get_attribute_str(const Element* const e, const char* const name);
 
-int get_attribute_int(const Element* const e, const std::string name);
+int get_attribute_int(const Element* const e, const char* const name);
 
 bool try_get_attribute_str(const Element* const e,
-                           const std::string name,
+                           const char* const name,
                            std::string& result);
 
 bool try_get_attribute_int(const Element* const e,
-                           const std::string name,
+                           const char* const name,
                            int& result);
 
 bool try_get_attribute_bool(const Element* const e,
-                            const std::string name,
+                            const char* const name,
                             bool& result);
 
 } // xml
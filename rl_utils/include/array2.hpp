@@ -1,12 +1,27 @@
 #ifndef RL_UTILS_ARRAY2_HPP
 #define RL_UTILS_ARRAY2_HPP
 
-#include <functional>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
 
 #include "pos.hpp"
 
+// Order of the elements in memory
+enum class Array2Layout
+{
+        // Elements of the same column (x) are contiguous, i.e. the same layout
+        // as "T array[w][h]" (used for most map arrays)
+        col_major,
+
+        // Elements of the same row (y) are contiguous, e.g. suitable for data
+        // read line by line from text
+        row_major
+};
+
 // Two dimensional array class
-template<typename T>
+template<typename T, Array2Layout layout = Array2Layout::col_major>
 class Array2
 {
 public:
@@ -33,43 +48,67 @@ public:
                 delete[] data_;
         }
 
-        Array2(const Array2<T>& other) :
+        Array2(const Array2& other) :
                 data_   (nullptr),
                 dims_   ()
         {
-                resize(other.dims_);
+                copy_from(other);
+        }
 
-                const size_t size = nr_elements();
+        Array2(Array2&& other) noexcept :
+                data_   (other.data_),
+                dims_   (other.dims_)
+        {
+                other.data_ = nullptr;
 
-                for (size_t idx = 0; idx < size; ++idx)
+                other.dims_.set(0, 0);
+        }
+
+        Array2& operator=(const Array2& other)
+        {
+                if (&other != this)
                 {
-                        data_[idx] = other.data_[idx];
+                        copy_from(other);
                 }
+
+                return *this;
         }
 
-        Array2<T>& operator=(const Array2<T>& other)
+        Array2& operator=(Array2&& other) noexcept
         {
-                resize(other.dims_);
+                if (&other != this)
+                {
+                        delete[] data_;
 
-                const size_t size = nr_elements();
+                        data_ = other.data_;
+                        dims_ = other.dims_;
 
-                for (size_t idx = 0; idx < size; ++idx)
-                {
-                        data_[idx] = other.data_[idx];
+                        other.data_ = nullptr;
+
+                        other.dims_.set(0, 0);
                 }
 
                 return *this;
         }
 
+        // NOTE: The element values are undefined after resizing (unless the
+        // number of elements is unchanged, then the buffer is kept as is)
         void resize(const P& dims)
         {
+                const size_t size_before = nr_elements();
+
                 dims_ = dims;
 
                 const size_t size = nr_elements();
 
+                if (data_ && (size == size_before))
+                {
+                        return;
+                }
+
                 delete[] data_;
 
-                data_ = new T[size];
+                data_ = (size > 0) ? new T[size] : nullptr;
         }
 
         void resize(const int w, const int h)
@@ -79,40 +118,57 @@ public:
 
         void rotate_cw()
         {
-                const P my_dims(dims());
+                transpose();
+
+                flip_hor();
+        }
+
+        void rotate_ccw()
+        {
+                transpose();
 
-                Array2<T> rotated(my_dims.y, my_dims.x);
+                flip_ver();
+        }
 
-                for (int x = 0; x < my_dims.x; ++x)
+        // Swaps the x and y axes (square arrays are transposed in place)
+        void transpose()
+        {
+                const P d(dims());
+
+                if (d.x == d.y)
                 {
-                        for (int y = 0; y < my_dims.y; ++y)
+                        for (int x = 0; x < d.x; ++x)
                         {
-                                const size_t my_idx = pos_to_idx(x, y);
-
-                                rotated(my_dims.y - 1 - y, x) = data_[my_idx];
+                                for (int y = x + 1; y < d.y; ++y)
+                                {
+                                        std::swap(data_[pos_to_idx(x, y)],
+                                                  data_[pos_to_idx(y, x)]);
+                                }
                         }
-                }
 
-                *this = rotated;
-        }
+                        return;
+                }
 
-        void rotate_ccw()
-        {
-                const P my_dims(dims());
+                T* const transposed = new T[nr_elements()];
 
-                Array2<T> rotated(my_dims.y, my_dims.x);
+                const P transposed_dims(d.y, d.x);
 
-                for (int x = 0; x < my_dims.x; ++x)
+                for (int x = 0; x < d.x; ++x)
                 {
-                        for (int y = 0; y < my_dims.y; ++y)
+                        for (int y = 0; y < d.y; ++y)
                         {
-                                const size_t my_idx = pos_to_idx(x, y);
+                                const size_t transposed_idx =
+                                        pos_to_idx(y, x, transposed_dims);
 
-                                rotated(y, my_dims.x - 1 - x) = data_[my_idx];
+                                transposed[transposed_idx] =
+                                        std::move(data_[pos_to_idx(x, y)]);
                         }
                 }
 
-                *this = rotated;
+                delete[] data_;
+
+                data_ = transposed;
+                dims_ = transposed_dims;
         }
 
         void flip_hor()
@@ -147,27 +203,48 @@ public:
                 }
         }
 
-        T& at(const P& p) const
+        T& at(const P& p)
         {
                 return get_element_ref(p);
         }
 
-        T& at(const int x, const int y) const
+        const T& at(const P& p) const
+        {
+                return get_element_ref(p);
+        }
+
+        T& at(const int x, const int y)
+        {
+                return get_element_ref(P(x, y));
+        }
+
+        const T& at(const int x, const int y) const
         {
                 return get_element_ref(P(x, y));
         }
 
-        T& operator()(const P& p) const
+        T& operator()(const P& p)
         {
                 return get_element_ref(p);
         }
 
-        T& operator()(const int x, const int y) const
+        const T& operator()(const P& p) const
+        {
+                return get_element_ref(p);
+        }
+
+        T& operator()(const int x, const int y)
         {
                 return get_element_ref(P(x, y));
         }
 
-        void for_each(std::function<void(T& v)> func)
+        const T& operator()(const int x, const int y) const
+        {
+                return get_element_ref(P(x, y));
+        }
+
+        template<typename Func>
+        void for_each(Func func)
         {
                 const size_t size = nr_elements();
 
@@ -177,10 +254,17 @@ public:
                 }
         }
 
+        void fill(const T& value)
+        {
+                std::fill_n(data_, nr_elements(), value);
+        }
+
         void clear()
         {
                 delete[] data_;
 
+                data_ = nullptr;
+
                 dims_.set(0, 0);
         }
 
@@ -189,24 +273,102 @@ public:
                 return dims_;
         }
 
-private:
-        T& get_element_ref(const P& p) const
+        // Contiguous access to all elements, in the order of the layout
+        T* data()
         {
-                check_pos(p);
+                return data_;
+        }
+
+        const T* data() const
+        {
+                return data_;
+        }
+
+        size_t size() const
+        {
+                return nr_elements();
+        }
+
+        T* begin()
+        {
+                return data_;
+        }
+
+        T* end()
+        {
+                return data_ + nr_elements();
+        }
 
-                const size_t idx = pos_to_idx(p);
+        const T* begin() const
+        {
+                return data_;
+        }
 
-                return data_[idx];
+        const T* end() const
+        {
+                return data_ + nr_elements();
         }
 
+        // Index of a position in the contiguous element buffer
         size_t pos_to_idx(const P& p) const
         {
-                return (p.x * dims_.y) + p.y;
+                return pos_to_idx(p.x, p.y, dims_);
         }
 
         size_t pos_to_idx(const int x, const int y) const
         {
-                return pos_to_idx(P(x, y));
+                return pos_to_idx(x, y, dims_);
+        }
+
+private:
+        static size_t pos_to_idx(const int x, const int y, const P& dims)
+        {
+                return
+                        (layout == Array2Layout::col_major) ?
+                        ((x * dims.y) + y) :
+                        ((y * dims.x) + x);
+        }
+
+        void copy_from(const Array2& other)
+        {
+                resize(other.dims_);
+
+                const size_t size = nr_elements();
+
+                if (size == 0)
+                {
+                        return;
+                }
+
+                copy_elements(other.data_, size, std::is_trivially_copyable<T>());
+        }
+
+        void copy_elements(const T* const src,
+                           const size_t size,
+                           std::true_type /* Is trivially copyable */)
+        {
+                memcpy(data_, src, size * sizeof(T));
+        }
+
+        void copy_elements(const T* const src,
+                           const size_t size,
+                           std::false_type /* Is trivially copyable */)
+        {
+                std::copy(src, src + size, data_);
+        }
+
+        T& get_element_ref(const P& p)
+        {
+                check_pos(p);
+
+                return data_[pos_to_idx(p)];
+        }
+
+        const T& get_element_ref(const P& p) const
+        {
+                check_pos(p);
+
+                return data_[pos_to_idx(p)];
         }
 
         size_t nr_elements() const
@@ -0,0 +1,110 @@
+#ifndef RL_UTILS_BLOCK_POOL_HPP
+#define RL_UTILS_BLOCK_POOL_HPP
+
+#include <cstddef>
+#include <new>
+
+// Allocator for objects which are created and destroyed in large numbers (e.g.
+// as class specific "operator new" and "operator delete"). Memory is taken from
+// free lists of fixed size blocks, with one list per block size, and the blocks
+// are allocated in chunks - so objects created together are mostly placed next
+// to each other in memory. The memory is never released, it is reused by later
+// objects of the same size.
+class BlockPool
+{
+public:
+        constexpr BlockPool(const size_t nr_blocks_per_chunk) :
+                nr_blocks_per_chunk_    (nr_blocks_per_chunk),
+                free_blocks_            () {}
+
+        BlockPool(const BlockPool&) = delete;
+
+        BlockPool& operator=(const BlockPool&) = delete;
+
+        void* allocate(const size_t size)
+        {
+                if (size > block_max_size)
+                {
+                        return ::operator new(size);
+                }
+
+                const size_t list_idx = free_list_idx(size);
+
+                FreeBlock*& free_list = free_blocks_[list_idx];
+
+                if (!free_list)
+                {
+                        const size_t block_size = (list_idx + 1) * block_align;
+
+                        char* const chunk = static_cast<char*>(
+                                ::operator new(
+                                        block_size * nr_blocks_per_chunk_));
+
+                        // Linked backwards, so that the blocks are handed out
+                        // in the order of their addresses
+                        for (size_t i = nr_blocks_per_chunk_; i > 0; --i)
+                        {
+                                auto* const block =
+                                        reinterpret_cast<FreeBlock*>(
+                                                chunk + ((i - 1) * block_size));
+
+                                block->next = free_list;
+
+                                free_list = block;
+                        }
+                }
+
+                FreeBlock* const block = free_list;
+
+                free_list = block->next;
+
+                return block;
+        }
+
+        // NOTE: The size must be the same as when allocating - for classes
+        // with a virtual destructor, the size passed to a class specific
+        // "operator delete" is the size of the dynamic type, as required
+        void free(void* const ptr, const size_t size)
+        {
+                if (!ptr)
+                {
+                        return;
+                }
+
+                if (size > block_max_size)
+                {
+                        ::operator delete(ptr);
+
+                        return;
+                }
+
+                auto* const block = static_cast<FreeBlock*>(ptr);
+
+                FreeBlock*& free_list = free_blocks_[free_list_idx(size)];
+
+                block->next = free_list;
+
+                free_list = block;
+        }
+
+private:
+        struct FreeBlock
+        {
+                FreeBlock* next;
+        };
+
+        static const size_t block_align = alignof(std::max_align_t);
+
+        static const size_t block_max_size = 256;
+
+        static size_t free_list_idx(const size_t size)
+        {
+                return ((size + block_align - 1) / block_align) - 1;
+        }
+
+        const size_t nr_blocks_per_chunk_;
+
+        FreeBlock* free_blocks_[block_max_size / block_align];
+};
+
+#endif // RL_UTILS_BLOCK_POOL_HPP
@@ -0,0 +1,78 @@
+#ifndef RL_UTILS_PROFILE_HPP
+#define RL_UTILS_PROFILE_HPP
+
+//------------------------------------------------------------------------------
+// Profiling zones (only enabled when IA_PROFILE is defined)
+//------------------------------------------------------------------------------
+// A zone is measured from the construction to the destruction of a
+// profile::Scope, and recorded in a ring buffer owned by the current thread
+// (so recording never takes a lock). Only the most recent zones are kept per
+// thread. All zones can be written to a file in the Chrome "trace event"
+// format, which can be viewed in chrome://tracing or Perfetto.
+//
+// Use the PROFILE_SCOPE macro rather than profile::Scope directly, e.g.:
+//
+//     PROFILE_SCOPE("build_map");
+//
+// The name must be a string with static storage duration (e.g. a literal).
+//
+// NOTE: TRACE_FUNC_BEGIN (see rl_utils.hpp) also opens a zone for the
+// function when profiling.
+
+#ifdef IA_PROFILE
+
+#include <cstdint>
+#include <string>
+
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+
+#define PROFILE_SCOPE(name) \
+    profile::Scope PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+
+namespace profile
+{
+
+// Nanoseconds since the profiler started
+int64_t now_ns();
+
+void record(const char* const name,
+            const int64_t begin_ns,
+            const int64_t end_ns);
+
+class Scope
+{
+public:
+    Scope(const char* const name) :
+        name_       (name),
+        begin_ns_   (now_ns()) {}
+
+    ~Scope()
+    {
+        record(name_, begin_ns_, now_ns());
+    }
+
+    Scope(const Scope&) = delete;
+
+    Scope& operator=(const Scope&) = delete;
+
+private:
+    const char* const name_;
+    const int64_t begin_ns_;
+};
+
+// Writes the zones currently held by all threads, returns false if the file
+// could not be written
+// NOTE: Zones being recorded by other threads while dumping may be missed or
+// partially written, so preferably dump while other threads are idle
+bool dump_chrome_trace(const std::string& path);
+
+} // profile
+
+#else // IA_PROFILE
+
+#define PROFILE_SCOPE(name)
+
+#endif // IA_PROFILE
+
+#endif // RL_UTILS_PROFILE_HPP
@@ -1,8 +1,9 @@
 #ifndef RL_UTILS_RANDOM_HPP
 #define RL_UTILS_RANDOM_HPP
 
-#include <random>
+#include <cstdint>
 #include <algorithm>
+#include <vector>
 #include <string>
 #include <iomanip>
 #include <sstream>
@@ -104,15 +105,15 @@ struct Dice
 
 struct Range
 {
-    Range() :
+    constexpr Range() :
         min(-1),
         max(-1) {}
 
-    Range(const int min, const int max) :
+    constexpr Range(const int min, const int max) :
         min(min),
         max(max) {}
 
-    Range(const Range& other) :
+    constexpr Range(const Range& other) :
         Range(other.min, other.max) {}
 
     int len() const
@@ -174,18 +175,110 @@ struct Fraction
     int num, den;
 };
 
+//------------------------------------------------------------------------------
+// Random number generator
+//------------------------------------------------------------------------------
+// Small and fast generator (PCG32) - 64 bits of state and a 64 bit stream
+// selector, so copying or saving the state is cheap, and generators seeded
+// with the same seed but different stream ids give independent sequences.
+class Rng
+{
+public:
+    Rng() :
+        state_(0),
+        inc_(1) {}
+
+    void seed(const uint64_t seed, const uint64_t stream_id);
+
+    uint32_t next()
+    {
+        const uint64_t old_state = state_;
+
+        state_ = (old_state * 6364136223846793005ULL) + inc_;
+
+        const uint32_t xor_shifted =
+            (uint32_t)(((old_state >> 18u) ^ old_state) >> 27u);
+
+        const uint32_t rot = (uint32_t)(old_state >> 59u);
+
+        return (xor_shifted >> rot) | (xor_shifted << ((-rot) & 31u));
+    }
+
+    // Unbiased value in the range [0, bound - 1], bound must be positive
+    uint32_t next_bounded(const uint32_t bound);
+
+    // Value in the range [0.0, 1.0)
+    double next_unit()
+    {
+        return (double)next() * (1.0 / 4294967296.0);
+    }
+
+    uint64_t state() const
+    {
+        return state_;
+    }
+
+    uint64_t inc() const
+    {
+        return inc_;
+    }
+
+    void set_state(const uint64_t state, const uint64_t inc)
+    {
+        state_ = state;
+        inc_ = inc | 1u;
+    }
+
+private:
+    uint64_t state_;
+    uint64_t inc_;
+};
+
 //------------------------------------------------------------------------------
 // Random number generation
 //------------------------------------------------------------------------------
 namespace rnd
 {
 
-extern std::mt19937 rng;
+// Independent random number streams - e.g. drawing an extra number for some
+// animation does not change the next level or the outcome of a fight.
+enum class Stream
+{
+    game,       // Anything not covered by the other streams
+    mapgen,
+    ai,
+    combat,
+    cosmetic,   // Only for things not affecting the game state
+    END
+};
 
-void seed();
+// Seeds all streams (each stream gets a different sequence from the seed),
+// from the current time - returns the seed used
+uint32_t seed();
 
 void seed(uint32_t seed);
 
+// The generator used by all functions below
+Rng& rng();
+
+Rng& stream_rng(const Stream stream);
+
+// Draws numbers from the given stream while an object of this class exists
+class StreamScope
+{
+public:
+    StreamScope(const Stream stream);
+
+    ~StreamScope();
+
+    StreamScope(const StreamScope&) = delete;
+
+    StreamScope& operator=(const StreamScope&) = delete;
+
+private:
+    Stream prev_stream_;
+};
+
 // NOTE: If not called with a positive non-zero number of sides, this will
 // always return zero.
 int dice(const int rolls, const int sides);
@@ -224,7 +317,13 @@ size_t idx(const std::vector<T>& v)
 template <typename T>
 void shuffle(std::vector<T>& v)
 {
-    std::shuffle(begin(v), end(v), rng);
+    // Fisher-Yates
+    for (size_t i = v.size(); i > 1; --i)
+    {
+        const size_t j = rng().next_bounded((uint32_t)i);
+
+        std::swap(v[i - 1], v[j]);
+    }
 }
 
 } // rnd
@@ -22,8 +22,8 @@
 #define ASSERT(check)
 
 #define TRACE                     if (1) ; else std::cerr
-#define TRACE_FUNC_BEGIN          if (1) ; else std::cerr
-#define TRACE_FUNC_END            if (1) ; else std::cerr
+#define TRACE_FUNC_BEGIN_OUTPUT   if (1) ; else std::cerr
+#define TRACE_FUNC_END_OUTPUT     if (1) ; else std::cerr
 #define TRACE_VERBOSE             if (1) ; else std::cerr
 #define TRACE_FUNC_BEGIN_VERBOSE  if (1) ; else std::cerr
 #define TRACE_FUNC_END_VERBOSE    if (1) ; else std::cerr
@@ -43,7 +43,7 @@
             << __func__ << "():"                \
             << std::endl
 
-#define TRACE_FUNC_BEGIN if (TRACE_LVL < 1) ; else      \
+#define TRACE_FUNC_BEGIN_OUTPUT if (TRACE_LVL < 1) ; else \
         std::cerr                                       \
             << "DEBUG: "                                \
             << __FILE__ << ", "                         \
@@ -51,7 +51,7 @@
             << __func__ << "() [BEGIN]"                 \
             << std::endl
 
-#define TRACE_FUNC_END if (TRACE_LVL < 1) ; else        \
+#define TRACE_FUNC_END_OUTPUT if (TRACE_LVL < 1) ; else   \
         std::cerr                                       \
             << "DEBUG: "                                \
             << __FILE__ << ", "                         \
@@ -60,13 +60,36 @@
             << std::endl
 
 #define TRACE_VERBOSE             if (TRACE_LVL < 2) ; else TRACE
-#define TRACE_FUNC_BEGIN_VERBOSE  if (TRACE_LVL < 2) ; else TRACE_FUNC_BEGIN
-#define TRACE_FUNC_END_VERBOSE    if (TRACE_LVL < 2) ; else TRACE_FUNC_END
+#define TRACE_FUNC_BEGIN_VERBOSE  \
+    if (TRACE_LVL < 2) ; else TRACE_FUNC_BEGIN_OUTPUT
+
+#define TRACE_FUNC_END_VERBOSE    \
+    if (TRACE_LVL < 2) ; else TRACE_FUNC_END_OUTPUT
 
 #define PANIC ASSERT(false)
 
 #endif // NDEBUG
 
+//------------------------------------------------------------------------------
+// Function begin/end trace
+//------------------------------------------------------------------------------
+// When profiling (IA_PROFILE defined), TRACE_FUNC_BEGIN also opens a profiling
+// zone (see profile.hpp) which lasts until the end of the enclosing scope - so
+// early returns without a TRACE_FUNC_END are still measured correctly.
+// NOTE: This means TRACE_FUNC_BEGIN must be used as a statement directly in
+// the function body (not as the body of an "if" without braces, etc).
+#ifdef IA_PROFILE
+
+#define TRACE_FUNC_BEGIN PROFILE_SCOPE(__func__); TRACE_FUNC_BEGIN_OUTPUT
+
+#else // IA_PROFILE
+
+#define TRACE_FUNC_BEGIN TRACE_FUNC_BEGIN_OUTPUT
+
+#endif // IA_PROFILE
+
+#define TRACE_FUNC_END TRACE_FUNC_END_OUTPUT
+
 // Print an error, for both debug and release builds
 #define TRACE_ERROR_RELEASE std::cerr << "ERROR: "
 
@@ -102,6 +125,7 @@ void assert_impl(const bool check,
 // RL Utils includes
 // NOTE: The user project only needs to include rl_utils.hpp (this file)
 #include "array2.hpp"
+#include "block_pool.hpp"
 #include "direction.hpp"
 #include "flood.hpp"
 #include "pathfind.hpp"
@@ -109,6 +133,7 @@ void assert_impl(const bool check,
 #include "random.hpp"
 #include "rect.hpp"
 #include "misc.hpp"
+#include "profile.hpp"
 #include "time.hpp"
 
 #endif // RL_UTILS_HPP
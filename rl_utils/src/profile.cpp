@@ -0,0 +1,169 @@
+#include "rl_utils.hpp"
+
+#ifdef IA_PROFILE
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <mutex>
+
+namespace
+{
+
+struct Zone
+{
+    const char* name;
+    int64_t begin_ns;
+    int64_t end_ns;
+};
+
+// Must be a power of two
+const size_t nr_zones_per_thread = 1 << 16;
+
+struct ThreadZones
+{
+    ThreadZones(const int thread_nr) :
+        zones       (),
+        nr_recorded (0),
+        thread_nr   (thread_nr) {}
+
+    Zone zones[nr_zones_per_thread];
+
+    // Only written by the owning thread, read when dumping
+    std::atomic<uint64_t> nr_recorded;
+
+    const int thread_nr;
+};
+
+const auto start_time = std::chrono::steady_clock::now();
+
+// The buffers of all threads which have recorded any zone. The buffers are
+// never deleted, so that zones of finished threads can still be dumped.
+std::mutex buffers_mutex;
+
+std::vector<ThreadZones*> buffers;
+
+thread_local ThreadZones* thread_zones = nullptr;
+
+ThreadZones* register_thread()
+{
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    auto* const zones = new ThreadZones((int)buffers.size());
+
+    buffers.push_back(zones);
+
+    return zones;
+}
+
+void put_json_str(std::ofstream& out, const char* str)
+{
+    out << '"';
+
+    for (; *str; ++str)
+    {
+        if ((*str == '"') || (*str == '\\'))
+        {
+            out << '\\';
+        }
+
+        out << *str;
+    }
+
+    out << '"';
+}
+
+} // namespace
+
+namespace profile
+{
+
+int64_t now_ns()
+{
+    const auto d = std::chrono::steady_clock::now() - start_time;
+
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+}
+
+void record(const char* const name,
+            const int64_t begin_ns,
+            const int64_t end_ns)
+{
+    if (!thread_zones)
+    {
+        thread_zones = register_thread();
+    }
+
+    const uint64_t idx =
+        thread_zones->nr_recorded.load(std::memory_order_relaxed);
+
+    thread_zones->zones[idx & (nr_zones_per_thread - 1)] =
+        {name, begin_ns, end_ns};
+
+    thread_zones->nr_recorded.store(idx + 1, std::memory_order_release);
+}
+
+bool dump_chrome_trace(const std::string& path)
+{
+    std::ofstream out(path);
+
+    if (!out.is_open())
+    {
+        return false;
+    }
+
+    out << std::fixed << std::setprecision(3);
+
+    out << "{\"traceEvents\":[\n";
+
+    bool is_first = true;
+
+    std::lock_guard<std::mutex> lock(buffers_mutex);
+
+    for (const ThreadZones* const thread_zones_dumped : buffers)
+    {
+        const uint64_t nr_recorded =
+            thread_zones_dumped->nr_recorded.load(std::memory_order_acquire);
+
+        // Only the most recent zones are still held by the ring buffer
+        const uint64_t first =
+            (nr_recorded > nr_zones_per_thread) ?
+            (nr_recorded - nr_zones_per_thread) :
+            0;
+
+        for (uint64_t i = first; i < nr_recorded; ++i)
+        {
+            const Zone& zone =
+                thread_zones_dumped->zones[i & (nr_zones_per_thread - 1)];
+
+            if (!is_first)
+            {
+                out << ",\n";
+            }
+
+            is_first = false;
+
+            // Chrome trace timestamps are in microseconds
+            out << "{\"name\":";
+
+            put_json_str(out, zone.name);
+
+            out << ",\"ph\":\"X\""
+                << ",\"pid\":0"
+                << ",\"tid\":" << thread_zones_dumped->thread_nr
+                << ",\"ts\":" << ((double)zone.begin_ns / 1000.0)
+                << ",\"dur\":"
+                << ((double)(zone.end_ns - zone.begin_ns) / 1000.0)
+                << "}";
+        }
+    }
+
+    out << "\n]}\n";
+
+    return out.good();
+}
+
+} // profile
+
+#endif // IA_PROFILE
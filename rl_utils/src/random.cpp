@@ -15,25 +15,93 @@ bool Fraction::roll() const
     return rnd::fraction(num, den);
 }
 
+void Rng::seed(const uint64_t seed, const uint64_t stream_id)
+{
+    state_ = 0;
+    inc_ = (stream_id << 1u) | 1u;
+
+    next();
+
+    state_ += seed;
+
+    next();
+}
+
+uint32_t Rng::next_bounded(const uint32_t bound)
+{
+    // Lemire's multiply and shift method - the rejection step (which only
+    // triggers for a small fraction of values) removes the bias
+    uint64_t m = (uint64_t)next() * (uint64_t)bound;
+
+    uint32_t low = (uint32_t)m;
+
+    if (low < bound)
+    {
+        const uint32_t threshold = (0u - bound) % bound;
+
+        while (low < threshold)
+        {
+            m = (uint64_t)next() * (uint64_t)bound;
+
+            low = (uint32_t)m;
+        }
+    }
+
+    return (uint32_t)(m >> 32u);
+}
+
 namespace rnd
 {
 
-std::mt19937 rng;
+namespace
+{
+
+Rng streams_[(size_t)Stream::END];
+
+Stream current_stream_ = Stream::game;
+
+} // namespace
 
-void seed()
+uint32_t seed()
 {
     uint32_t t = static_cast<uint32_t>(time(nullptr));
 
     std::hash<uint32_t> hasher;
 
-    size_t hashed = hasher(t);
+    const uint32_t hashed = static_cast<uint32_t>(hasher(t));
 
-    seed(static_cast<uint32_t>(hashed));
+    seed(hashed);
+
+    return hashed;
 }
 
 void seed(uint32_t seed)
 {
-    rng.seed(static_cast<std::mt19937::result_type>(seed));
+    for (size_t i = 0; i < (size_t)Stream::END; ++i)
+    {
+        streams_[i].seed(seed, i);
+    }
+}
+
+Rng& rng()
+{
+    return streams_[(size_t)current_stream_];
+}
+
+Rng& stream_rng(const Stream stream)
+{
+    return streams_[(size_t)stream];
+}
+
+StreamScope::StreamScope(const Stream stream) :
+    prev_stream_(current_stream_)
+{
+    current_stream_ = stream;
+}
+
+StreamScope::~StreamScope()
+{
+    current_stream_ = prev_stream_;
 }
 
 int range(const int v1, const int v2)
@@ -41,9 +109,15 @@ int range(const int v1, const int v2)
     const int min = std::min(v1, v2);
     const int max = std::max(v1, v2);
 
-    std::uniform_int_distribution<int> dist(min, max);
+    const uint32_t span = (uint32_t)((int64_t)max - (int64_t)min + 1);
 
-    return dist(rng);
+    // The whole range of int
+    if (span == 0)
+    {
+        return (int)rng().next();
+    }
+
+    return (int)((int64_t)min + (int64_t)rng().next_bounded(span));
 }
 
 int range_binom(const int v1, const int v2, const double p)
@@ -51,14 +125,21 @@ int range_binom(const int v1, const int v2, const double p)
     const int min = std::min(v1, v2);
     const int max = std::max(v1, v2);
 
-    const int upper_random_value = max - min;
+    const int nr_trials = max - min;
 
-    std::binomial_distribution<std::mt19937::result_type>
-        dist(upper_random_value, p);
+    // NOTE: This is only used for small ranges, so simply counting successful
+    // trials is fast enough
+    int nr_successes = 0;
 
-    const int random_value = dist(rng);
+    for (int i = 0; i < nr_trials; ++i)
+    {
+        if (rng().next_unit() < p)
+        {
+            ++nr_successes;
+        }
+    }
 
-    return min + random_value;
+    return min + nr_successes;
 }
 
 int dice(const int rolls, const int sides)
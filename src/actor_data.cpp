@@ -1,5 +1,8 @@
 #include "actor_data.hpp"
 
+#include <cstdint>
+#include <fstream>
+#include <iterator>
 #include <string>
 #include <vector>
 #include <math.h>
@@ -15,6 +18,10 @@
 // -----------------------------------------------------------------------------
 // Private
 // -----------------------------------------------------------------------------
+static const std::string xml_path = "res/data/monsters.xml";
+
+static const std::string db_path = "res/data/monsters.bin";
+
 // *****************************************************************************
 // TODO: TEMPORARY CODE
 // *****************************************************************************
@@ -521,10 +528,10 @@ static void dump_ai(xml::Element* ai_e, ActorData& data)
 
         for (size_t i = 0; i < (size_t)AiId::END; ++i)
         {
-                const std::string ai_id_str = ai_id_to_str_map.at((AiId)i);
+                const std::string& ai_id_str = ai_id_to_str_map.at((AiId)i);
 
                 data.ai[i] = xml::get_text_bool(
-                        xml::first_child(ai_e, ai_id_str));
+                        xml::first_child(ai_e, ai_id_str.c_str()));
         }
 }
 
@@ -567,7 +574,7 @@ static void dump_spawning(xml::Element* spawn_e, ActorData& data)
         data.nr_left_allowed_to_spawn = xml::get_text_int(
                 xml::first_child(spawn_e, "nr_allowed_to_spawn"));
 
-        const std::string group_size_element_str = "group_size";
+        const char* const group_size_element_str = "group_size";
 
         for (auto e = xml::first_child(spawn_e, group_size_element_str);
              e;
@@ -576,7 +583,7 @@ static void dump_spawning(xml::Element* spawn_e, ActorData& data)
                 dump_group_size(e, data);
         }
 
-        const std::string native_room_element_str = "native_room";
+        const char* const native_room_element_str = "native_room";
 
         for (auto e = xml::first_child(spawn_e, native_room_element_str);
              e;
@@ -600,11 +607,14 @@ static void dump_starting_allies(xml::Element* allies_e, ActorData& data)
         }
 }
 
-static void read_actor_definitions_xml()
+// Returns the number of monster definitions read
+static int read_actor_definitions_xml()
 {
         xml::Doc doc;
 
-        xml::load_file("res/data/monsters.xml", doc);
+        xml::load_file(xml_path, doc);
+
+        int nr_read = 0;
 
         auto top_e = xml::first_child(doc);
 
@@ -614,6 +624,8 @@ static void read_actor_definitions_xml()
         {
                 const ActorId id = get_id(mon_e);
 
+                ++nr_read;
+
                 ActorData& data = actor_data::data[(size_t)id];
 
                 data.reset();
@@ -672,8 +684,669 @@ static void read_actor_definitions_xml()
                         dump_starting_allies(allies_e, data);
                 }
         }
+
+        return nr_read;
 } // read_actor_definitions_xml
 
+// -----------------------------------------------------------------------------
+// Binary monster database
+// -----------------------------------------------------------------------------
+// monsters.xml is the editable source of truth, the binary database is a flat
+// dump of the parsed definitions which is regenerated whenever the xml file
+// has changed (detected by storing a hash of the xml file contents)
+// "IAMD" (IA Monster Data)
+static const uint32_t db_magic = 0x444D4149;
+
+// NOTE: Increment this whenever the layout written by "write_actor" changes
+static const uint32_t db_version = 2;
+
+class DbWriter
+{
+public:
+        void put_int(const int value)
+        {
+                const uint32_t bits = (uint32_t)value;
+
+                for (int i = 0; i < 4; ++i)
+                {
+                        buffer_ += (char)((bits >> (i * 8)) & 0xFF);
+                }
+        }
+
+        void put_bool(const bool value)
+        {
+                buffer_ += value ? (char)1 : (char)0;
+        }
+
+        void put_str(const std::string& str)
+        {
+                put_int((int)str.size());
+
+                buffer_ += str;
+        }
+
+        const std::string& buffer() const
+        {
+                return buffer_;
+        }
+
+private:
+        std::string buffer_;
+};
+
+// Reads from a database buffer, any read past the end (or any other
+// inconsistency) puts the reader in a failed state rather than aborting, so
+// that the caller can fall back on parsing the xml file
+class DbReader
+{
+public:
+        DbReader(const std::string& buffer) :
+                buffer_ (buffer),
+                pos_    (0),
+                is_ok_  (true) {}
+
+        int get_int()
+        {
+                if (!has_bytes(4))
+                {
+                        return 0;
+                }
+
+                uint32_t bits = 0;
+
+                for (int i = 0; i < 4; ++i)
+                {
+                        const uint32_t byte = (uint8_t)buffer_[pos_ + i];
+
+                        bits |= byte << (i * 8);
+                }
+
+                pos_ += 4;
+
+                return (int)bits;
+        }
+
+        // Reads an integer which must be in the range [min, max]
+        int get_int(const int min, const int max)
+        {
+                const int value = get_int();
+
+                if ((value < min) || (value > max))
+                {
+                        is_ok_ = false;
+
+                        return min;
+                }
+
+                return value;
+        }
+
+        bool get_bool()
+        {
+                if (!has_bytes(1))
+                {
+                        return false;
+                }
+
+                return buffer_[pos_++] != 0;
+        }
+
+        std::string get_str()
+        {
+                const int size = get_int();
+
+                if ((size < 0) || !has_bytes((size_t)size))
+                {
+                        is_ok_ = false;
+
+                        return "";
+                }
+
+                const std::string str = buffer_.substr(pos_, (size_t)size);
+
+                pos_ += (size_t)size;
+
+                return str;
+        }
+
+        bool is_ok() const
+        {
+                return is_ok_;
+        }
+
+        bool is_at_end() const
+        {
+                return pos_ == buffer_.size();
+        }
+
+private:
+        bool has_bytes(const size_t nr_bytes)
+        {
+                if (is_ok_ && ((buffer_.size() - pos_) < nr_bytes))
+                {
+                        is_ok_ = false;
+                }
+
+                return is_ok_;
+        }
+
+        const std::string& buffer_;
+        size_t pos_;
+        bool is_ok_;
+};
+
+static bool read_file(const std::string& path, std::string& to_str)
+{
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (!file.is_open())
+        {
+                return false;
+        }
+
+        to_str.assign(std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>());
+
+        return true;
+}
+
+// 32-bit FNV-1a
+static uint32_t hash_str(const std::string& str)
+{
+        uint32_t hash = 2166136261u;
+
+        for (const char c : str)
+        {
+                hash ^= (uint8_t)c;
+
+                hash *= 16777619u;
+        }
+
+        return hash;
+}
+
+// The enum sizes are stored in the header, so that a database written by a
+// build with a different set of actors, properties, etc is never loaded. Not
+// all enums stored in the records have an "END" value (e.g. RoomType), so the
+// time this file was compiled is stored as well - it is recompiled whenever a
+// header declaring any of the enums changes, which also catches reordering.
+static const uint32_t build_id = hash_str(__DATE__ " " __TIME__);
+
+static void write_header(DbWriter& writer, const uint32_t xml_hash)
+{
+        writer.put_int((int)db_magic);
+        writer.put_int((int)db_version);
+        writer.put_int((int)build_id);
+        writer.put_int((int)xml_hash);
+        writer.put_int((int)ActorId::END);
+        writer.put_int((int)PropId::END);
+        writer.put_int((int)AiId::END);
+        writer.put_int((int)AbilityId::END);
+        writer.put_int((int)TileId::END);
+        writer.put_int((int)ItemId::END);
+        writer.put_int((int)SfxId::END);
+        writer.put_int((int)SpellId::END);
+        writer.put_int((int)ShockLvl::END);
+}
+
+static bool read_header(DbReader& reader, const uint32_t xml_hash)
+{
+        return
+                ((uint32_t)reader.get_int() == db_magic) &&
+                ((uint32_t)reader.get_int() == db_version) &&
+                ((uint32_t)reader.get_int() == build_id) &&
+                ((uint32_t)reader.get_int() == xml_hash) &&
+                (reader.get_int() == (int)ActorId::END) &&
+                (reader.get_int() == (int)PropId::END) &&
+                (reader.get_int() == (int)AiId::END) &&
+                (reader.get_int() == (int)AbilityId::END) &&
+                (reader.get_int() == (int)TileId::END) &&
+                (reader.get_int() == (int)ItemId::END) &&
+                (reader.get_int() == (int)SfxId::END) &&
+                (reader.get_int() == (int)SpellId::END) &&
+                (reader.get_int() == (int)ShockLvl::END) &&
+                reader.is_ok();
+}
+
+// NOTE: The runtime state (number of kills, if seen by the player, etc) is
+// not stored, it is handled by the save file
+static void write_actor(DbWriter& writer, const ActorData& d)
+{
+        writer.put_int((int)d.id);
+        writer.put_str(d.name_a);
+        writer.put_str(d.name_the);
+        writer.put_str(d.corpse_name_a);
+        writer.put_str(d.corpse_name_the);
+        writer.put_int((int)d.tile);
+        writer.put_int((int)d.character);
+        writer.put_int(d.color.r());
+        writer.put_int(d.color.g());
+        writer.put_int(d.color.b());
+
+        writer.put_int((int)d.group_sizes.size());
+
+        for (const auto& rule : d.group_sizes)
+        {
+                writer.put_int((int)rule.group_size);
+                writer.put_int(rule.weight);
+        }
+
+        writer.put_int(d.hp);
+        writer.put_int(d.spi);
+
+        writer.put_int((int)d.item_sets.size());
+
+        for (const auto& item_set : d.item_sets)
+        {
+                writer.put_int((int)item_set.item_set_id);
+                writer.put_int(item_set.pct_chance_to_spawn);
+                writer.put_int(item_set.nr_spawned_range.min);
+                writer.put_int(item_set.nr_spawned_range.max);
+        }
+
+        writer.put_int((int)d.intr_attacks.size());
+
+        for (const auto& attack : d.intr_attacks)
+        {
+                writer.put_int((int)attack.item_id);
+                writer.put_int(attack.dmg);
+
+                const ItemAttProp& attack_prop = attack.prop_applied;
+
+                const Prop* const prop = attack_prop.prop;
+
+                writer.put_bool(prop);
+
+                if (prop)
+                {
+                        writer.put_int((int)prop->id());
+                        writer.put_int(attack_prop.pct_chance_to_apply);
+                        writer.put_int((int)prop->duration_mode());
+                        writer.put_int(prop->nr_turns_left());
+                }
+        }
+
+        writer.put_int((int)d.spells.size());
+
+        for (const auto& spell : d.spells)
+        {
+                writer.put_int((int)spell.spell_id);
+                writer.put_int((int)spell.spell_skill);
+                writer.put_int(spell.pct_chance_to_know);
+        }
+
+        writer.put_int(d.speed_pct);
+
+        for (size_t i = 0; i < (size_t)AbilityId::END; ++i)
+        {
+                writer.put_int(d.ability_values.raw_val((AbilityId)i));
+        }
+
+        for (size_t i = 0; i < (size_t)PropId::END; ++i)
+        {
+                writer.put_bool(d.natural_props[i]);
+        }
+
+        for (size_t i = 0; i < (size_t)AiId::END; ++i)
+        {
+                writer.put_bool(d.ai[i]);
+        }
+
+        writer.put_int(d.nr_turns_aware);
+        writer.put_int(d.ranged_cooldown_turns);
+        writer.put_int(d.spawn_min_dlvl);
+        writer.put_int(d.spawn_max_dlvl);
+        writer.put_int((int)d.actor_size);
+        writer.put_bool(d.allow_generated_descr);
+        writer.put_bool(d.can_open_doors);
+        writer.put_bool(d.can_bash_doors);
+        writer.put_bool(d.prevent_knockback);
+        writer.put_int(d.nr_left_allowed_to_spawn);
+        writer.put_bool(d.is_unique);
+        writer.put_bool(d.is_auto_spawn_allowed);
+        writer.put_str(d.descr);
+        writer.put_str(d.wary_msg);
+        writer.put_str(d.aware_msg_mon_seen);
+        writer.put_str(d.aware_msg_mon_hidden);
+        writer.put_bool(d.use_cultist_aware_msg_mon_seen);
+        writer.put_bool(d.use_cultist_aware_msg_mon_hidden);
+        writer.put_int((int)d.aware_sfx_mon_seen);
+        writer.put_int((int)d.aware_sfx_mon_hidden);
+        writer.put_str(d.spell_msg);
+        writer.put_str(d.death_msg_override);
+        writer.put_int(d.erratic_move_pct);
+        writer.put_int((int)d.mon_shock_lvl);
+        writer.put_bool(d.is_humanoid);
+        writer.put_bool(d.is_rat);
+        writer.put_bool(d.is_canine);
+        writer.put_bool(d.is_spider);
+        writer.put_bool(d.is_undead);
+        writer.put_bool(d.is_ghost);
+        writer.put_bool(d.is_ghoul);
+        writer.put_bool(d.is_snake);
+        writer.put_bool(d.is_reptile);
+        writer.put_bool(d.is_amphibian);
+        writer.put_bool(d.can_be_summoned_by_mon);
+        writer.put_bool(d.can_bleed);
+        writer.put_bool(d.can_leave_corpse);
+        writer.put_bool(d.prio_corpse_bash);
+
+        writer.put_int((int)d.native_rooms.size());
+
+        for (const auto room_type : d.native_rooms)
+        {
+                writer.put_int((int)room_type);
+        }
+
+        writer.put_int((int)d.starting_allies.size());
+
+        for (const auto ally_id : d.starting_allies)
+        {
+                writer.put_int((int)ally_id);
+        }
+}
+
+// NOTE: Must mirror "write_actor" exactly
+static void read_actor(DbReader& reader, ActorData& d)
+{
+        d.reset();
+
+        d.id = (ActorId)reader.get_int(0, (int)ActorId::END - 1);
+        d.name_a = reader.get_str();
+        d.name_the = reader.get_str();
+        d.corpse_name_a = reader.get_str();
+        d.corpse_name_the = reader.get_str();
+        d.tile = (TileId)reader.get_int();
+        d.character = (char)reader.get_int();
+
+        {
+                const uint8_t r = (uint8_t)reader.get_int(0, 255);
+                const uint8_t g = (uint8_t)reader.get_int(0, 255);
+                const uint8_t b = (uint8_t)reader.get_int(0, 255);
+
+                d.color = Color(r, g, b);
+        }
+
+        // NOTE: The default group size set by "reset" is part of the stored
+        // list, so the list is replaced rather than appended to
+        d.group_sizes.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& rule : d.group_sizes)
+        {
+                rule.group_size = (MonGroupSize)reader.get_int();
+                rule.weight = reader.get_int();
+        }
+
+        d.hp = reader.get_int();
+        d.spi = reader.get_int();
+
+        d.item_sets.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& item_set : d.item_sets)
+        {
+                item_set.item_set_id = (ItemSetId)reader.get_int();
+                item_set.pct_chance_to_spawn = reader.get_int();
+                item_set.nr_spawned_range.min = reader.get_int();
+                item_set.nr_spawned_range.max = reader.get_int();
+        }
+
+        d.intr_attacks.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& attack : d.intr_attacks)
+        {
+                attack.item_id = (ItemId)reader.get_int();
+                attack.dmg = reader.get_int();
+
+                if (!reader.get_bool())
+                {
+                        continue;
+                }
+
+                const auto prop_id =
+                        (PropId)reader.get_int(0, (int)PropId::END - 1);
+
+                ItemAttProp& attack_prop = attack.prop_applied;
+
+                attack_prop.pct_chance_to_apply = reader.get_int();
+
+                const auto duration_mode = (PropDurationMode)reader.get_int();
+
+                const int nr_turns = reader.get_int();
+
+                if (!reader.is_ok())
+                {
+                        return;
+                }
+
+                attack_prop.prop = property_factory::make(prop_id);
+
+                if (duration_mode == PropDurationMode::specific)
+                {
+                        attack_prop.prop->set_duration(nr_turns);
+                }
+                else if (duration_mode == PropDurationMode::indefinite)
+                {
+                        attack_prop.prop->set_indefinite();
+                }
+        }
+
+        d.spells.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& spell : d.spells)
+        {
+                spell.spell_id = (SpellId)reader.get_int();
+                spell.spell_skill = (SpellSkill)reader.get_int();
+                spell.pct_chance_to_know = reader.get_int();
+        }
+
+        d.speed_pct = reader.get_int();
+
+        for (size_t i = 0; i < (size_t)AbilityId::END; ++i)
+        {
+                d.ability_values.set_val((AbilityId)i, reader.get_int());
+        }
+
+        for (size_t i = 0; i < (size_t)PropId::END; ++i)
+        {
+                d.natural_props[i] = reader.get_bool();
+        }
+
+        for (size_t i = 0; i < (size_t)AiId::END; ++i)
+        {
+                d.ai[i] = reader.get_bool();
+        }
+
+        d.nr_turns_aware = reader.get_int();
+        d.ranged_cooldown_turns = reader.get_int();
+        d.spawn_min_dlvl = reader.get_int();
+        d.spawn_max_dlvl = reader.get_int();
+        d.actor_size = (ActorSize)reader.get_int();
+        d.allow_generated_descr = reader.get_bool();
+        d.can_open_doors = reader.get_bool();
+        d.can_bash_doors = reader.get_bool();
+        d.prevent_knockback = reader.get_bool();
+        d.nr_left_allowed_to_spawn = reader.get_int();
+        d.is_unique = reader.get_bool();
+        d.is_auto_spawn_allowed = reader.get_bool();
+        d.descr = reader.get_str();
+        d.wary_msg = reader.get_str();
+        d.aware_msg_mon_seen = reader.get_str();
+        d.aware_msg_mon_hidden = reader.get_str();
+        d.use_cultist_aware_msg_mon_seen = reader.get_bool();
+        d.use_cultist_aware_msg_mon_hidden = reader.get_bool();
+        d.aware_sfx_mon_seen = (SfxId)reader.get_int();
+        d.aware_sfx_mon_hidden = (SfxId)reader.get_int();
+        d.spell_msg = reader.get_str();
+        d.death_msg_override = reader.get_str();
+        d.erratic_move_pct = reader.get_int();
+        d.mon_shock_lvl = (ShockLvl)reader.get_int();
+        d.is_humanoid = reader.get_bool();
+        d.is_rat = reader.get_bool();
+        d.is_canine = reader.get_bool();
+        d.is_spider = reader.get_bool();
+        d.is_undead = reader.get_bool();
+        d.is_ghost = reader.get_bool();
+        d.is_ghoul = reader.get_bool();
+        d.is_snake = reader.get_bool();
+        d.is_reptile = reader.get_bool();
+        d.is_amphibian = reader.get_bool();
+        d.can_be_summoned_by_mon = reader.get_bool();
+        d.can_bleed = reader.get_bool();
+        d.can_leave_corpse = reader.get_bool();
+        d.prio_corpse_bash = reader.get_bool();
+
+        d.native_rooms.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& room_type : d.native_rooms)
+        {
+                room_type = (RoomType)reader.get_int();
+        }
+
+        d.starting_allies.resize((size_t)reader.get_int(0, 255));
+
+        for (auto& ally_id : d.starting_allies)
+        {
+                ally_id = (ActorId)reader.get_int(0, (int)ActorId::END - 1);
+        }
+}
+
+static bool write_db(const uint32_t xml_hash)
+{
+        DbWriter writer;
+
+        write_header(writer, xml_hash);
+
+        for (const auto& d : actor_data::data)
+        {
+                write_actor(writer, d);
+        }
+
+        std::ofstream file(db_path,
+                           std::ios::out |
+                           std::ios::binary |
+                           std::ios::trunc);
+
+        if (!file.is_open())
+        {
+                return false;
+        }
+
+        const std::string& buffer = writer.buffer();
+
+        file.write(buffer.data(), buffer.size());
+
+        return file.good();
+}
+
+static bool read_db(const uint32_t xml_hash)
+{
+        std::string buffer;
+
+        if (!read_file(db_path, buffer))
+        {
+                return false;
+        }
+
+        DbReader reader(buffer);
+
+        if (!read_header(reader, xml_hash))
+        {
+                return false;
+        }
+
+        for (size_t i = 0; (i < (size_t)ActorId::END) && reader.is_ok(); ++i)
+        {
+                read_actor(reader, actor_data::data[i]);
+
+                if (actor_data::data[i].id != (ActorId)i)
+                {
+                        return false;
+                }
+        }
+
+        return reader.is_ok() && reader.is_at_end();
+}
+
+// Checks for mistakes in the monster definitions which the parsing itself
+// does not catch, returns the number of errors found
+static int validate_actor(const ActorData& d)
+{
+        int nr_errors = 0;
+
+        auto error = [&](const std::string& msg) {
+                TRACE_ERROR_RELEASE
+                        << "Monster \""
+                        << actor_id_to_str_map.at(d.id)
+                        << "\": "
+                        << msg
+                        << std::endl;
+
+                ++nr_errors;
+        };
+
+        if (d.name_a.empty() || d.name_the.empty())
+        {
+                error("Missing name");
+        }
+
+        if (d.hp <= 0)
+        {
+                error("Hit points must be positive");
+        }
+
+        if (d.speed_pct <= 0)
+        {
+                error("Speed must be positive");
+        }
+
+        // NOTE: A max dungeon level of -1 means "no limit"
+        if ((d.spawn_max_dlvl >= 0) &&
+            (d.spawn_min_dlvl > d.spawn_max_dlvl))
+        {
+                error("Min dungeon level is higher than max dungeon level");
+        }
+
+        if ((d.erratic_move_pct < 0) || (d.erratic_move_pct > 100))
+        {
+                error("Invalid erratic move percent");
+        }
+
+        for (const auto& rule : d.group_sizes)
+        {
+                if (rule.weight <= 0)
+                {
+                        error("Group size weight must be positive");
+                }
+        }
+
+        for (const auto& item_set : d.item_sets)
+        {
+                if ((item_set.pct_chance_to_spawn <= 0) ||
+                    (item_set.pct_chance_to_spawn > 100))
+                {
+                        error("Invalid item set spawn chance");
+                }
+
+                if ((item_set.nr_spawned_range.min < 0) ||
+                    (item_set.nr_spawned_range.min >
+                     item_set.nr_spawned_range.max))
+                {
+                        error("Invalid item set spawn range");
+                }
+        }
+
+        for (const auto& spell : d.spells)
+        {
+                if ((spell.pct_chance_to_know <= 0) ||
+                    (spell.pct_chance_to_know > 100))
+                {
+                        error("Invalid spell chance");
+                }
+        }
+
+        return nr_errors;
+}
+
 // -----------------------------------------------------------------------------
 // ActorData
 // -----------------------------------------------------------------------------
@@ -769,9 +1442,114 @@ void init()
 {
         TRACE_FUNC_BEGIN;
 
-        read_actor_definitions_xml();
+        std::string xml_str;
+
+        if (!read_file(xml_path, xml_str))
+        {
+                TRACE_ERROR_RELEASE << "Failed to read file at: "
+                                    << xml_path
+                                    << std::endl;
+
+                PANIC;
+        }
+
+        const uint32_t xml_hash = hash_str(xml_str);
+
+        if (!read_db(xml_hash))
+        {
+                TRACE << "Monster database missing or out of date, "
+                      << "parsing " << xml_path << std::endl;
+
+                read_actor_definitions_xml();
+
+                if (!write_db(xml_hash))
+                {
+                        // Not critical, the xml file is parsed next time
+                        TRACE << "Failed to write " << db_path << std::endl;
+                }
+        }
+
+        TRACE_FUNC_END;
+}
+
+bool validate_data()
+{
+        TRACE_FUNC_BEGIN;
+
+        std::string xml_str;
+
+        if (!read_file(xml_path, xml_str))
+        {
+                TRACE_ERROR_RELEASE << "Failed to read file at: "
+                                    << xml_path
+                                    << std::endl;
+
+                return false;
+        }
+
+        for (auto& d : data)
+        {
+                d.reset();
+        }
+
+        // NOTE: Malformed xml or unknown names are fatal errors in the parsing
+        const int nr_read = read_actor_definitions_xml();
+
+        int nr_errors = 0;
+
+        for (size_t i = 0; i < (size_t)ActorId::END; ++i)
+        {
+                const ActorData& d = data[i];
+
+                if (d.id != (ActorId)i)
+                {
+                        TRACE_ERROR_RELEASE
+                                << "Monster \""
+                                << actor_id_to_str_map.at((ActorId)i)
+                                << "\" is not defined"
+                                << std::endl;
+
+                        ++nr_errors;
+
+                        continue;
+                }
+
+                nr_errors += validate_actor(d);
+        }
+
+        if (nr_read != (int)ActorId::END)
+        {
+                TRACE_ERROR_RELEASE << "Expected "
+                                    << (int)ActorId::END
+                                    << " monster definitions, found "
+                                    << nr_read
+                                    << std::endl;
+
+                ++nr_errors;
+        }
+
+        if (nr_errors > 0)
+        {
+                TRACE_ERROR_RELEASE << nr_errors
+                                    << " error(s) in "
+                                    << xml_path
+                                    << std::endl;
+
+                return false;
+        }
+
+        if (!write_db(hash_str(xml_str)))
+        {
+                TRACE_ERROR_RELEASE << "Failed to write "
+                                    << db_path
+                                    << std::endl;
+
+                return false;
+        }
 
         TRACE_FUNC_END;
+
+        return true;
 }
 
 void save()
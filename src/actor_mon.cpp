@@ -32,6 +32,7 @@
 #include "text_format.hpp"
 #include "feature_door.hpp"
 #include "drop.hpp"
+#include "perf_stats.hpp"
 
 // -----------------------------------------------------------------------------
 // Private
@@ -107,6 +108,10 @@ void Mon::on_actor_turn()
 
 void Mon::act()
 {
+        perf_stats::Measure perf_measure(PerfCounter::mon_act);
+
+        rnd::StreamScope rnd_stream(rnd::Stream::ai);
+
         const bool is_player_leader = is_actor_my_leader(map::player);
 
 #ifndef NDEBUG
@@ -458,6 +463,23 @@ bool Mon::can_see_actor(const Actor& other,
                 return false;
         }
 
+        return is_noticing_seeable_actor(other);
+}
+
+bool Mon::can_see_actor(const Actor& other, const LosResult& los) const
+{
+        const bool is_seeable = is_actor_seeable(other, los);
+
+        if (!is_seeable)
+        {
+                return false;
+        }
+
+        return is_noticing_seeable_actor(other);
+}
+
+bool Mon::is_noticing_seeable_actor(const Actor& other) const
+{
         if (is_actor_my_leader(map::player))
         {
                 // Monster is allied to player
@@ -510,7 +532,25 @@ bool Mon::is_actor_seeable(const Actor& other,
                                 other.pos,
                                 hard_blocked_los);
 
-        // LOS blocked hard (e.g. a wall or smoke)?
+        return is_actor_seeable(other, los);
+}
+
+bool Mon::is_actor_seeable(const Actor& other, const LosResult& los) const
+{
+        if ((this == &other) ||
+            (!other.is_alive()))
+        {
+                return true;
+        }
+
+        // Monster is blind?
+        if (!properties_->allow_see())
+        {
+                return false;
+        }
+
+        // LOS blocked hard (e.g. a wall or smoke)? This is also the result for
+        // actors outside FOV range.
         if (los.is_blocked_hard)
         {
                 return false;
@@ -1032,7 +1072,7 @@ DidAction Mon::try_attack(Actor& defender)
                 return DidAction::no;
         }
 
-        map::update_vision();
+        map::request_vision_update();
 
         const AiAvailAttacksData my_avail_attacks = avail_attacks(defender);
 
@@ -39,6 +39,7 @@
 #include "insanity.hpp"
 #include "reload.hpp"
 #include "drop.hpp"
+#include "perf_stats.hpp"
 
 // -----------------------------------------------------------------------------
 // Private
@@ -160,6 +161,8 @@ bool Player::can_see_actor(const Actor& other) const
         return true;
     }
 
+    map::update_vision_if_stale();
+
     const Cell& cell = map::cells[other.pos.x][other.pos.y];
 
     // Dead actors are seen if the cell is seen
@@ -2115,6 +2118,8 @@ void Player::add_light_hook(bool light_map[map_w][map_h]) const
 
 void Player::update_fov()
 {
+    perf_stats::Measure perf_measure(PerfCounter::update_fov);
+
     for (int x = 0; x < map_w; ++x)
     {
         for (int y = 0; y < map_h; ++y)
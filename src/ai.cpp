@@ -1,5 +1,7 @@
 #include "ai.hpp"
 
+#include <algorithm>
+
 #include "actor_player.hpp"
 #include "msg_log.hpp"
 #include "map.hpp"
@@ -12,6 +14,7 @@
 #include "fov.hpp"
 #include "text_format.hpp"
 #include "property_handler.hpp"
+#include "perf_stats.hpp"
 
 namespace ai
 {
@@ -195,6 +198,19 @@ bool is_pos_on_line(const P& p,
 
         // OK, we could be on the line!
 
+        // The precalculated FOV lines cover all monsters seeing the player
+        const std::vector<P>* const delta_line =
+                line_calc::fov_delta_line(line_p1 - line_p0, fov_max_radi_db);
+
+        if (delta_line)
+        {
+                const P delta(p - line_p0);
+
+                return
+                        std::find(begin(*delta_line), end(*delta_line), delta) !=
+                        end(*delta_line);
+        }
+
         const auto line =
                 line_calc::calc_new_line(line_p0,
                                          line_p1,
@@ -213,6 +229,68 @@ bool is_pos_on_line(const P& p,
         return false;
 }
 
+// Line of sight data shared by all monsters trying to make room for each other
+// during the same actor round. The blocked cells are parsed once per round, and
+// the line of sight from a cell to the player is checked at most once per round
+// and player position - monsters which have not moved reuse the result.
+struct FriendLosCache
+{
+        int actor_round_nr = -1;
+
+        P player_p = P(-1, -1);
+
+        bool blocked_los[map_w][map_h];
+
+        bool is_los_to_player_set[map_w][map_h];
+
+        LosResult los_to_player[map_w][map_h];
+};
+
+FriendLosCache los_cache_;
+
+void update_los_cache()
+{
+        const int actor_round_nr = game_time::actor_round_nr();
+
+        const P& player_p = map::player->pos;
+
+        if (actor_round_nr != los_cache_.actor_round_nr)
+        {
+                map_parsers::BlocksLos()
+                        .run(los_cache_.blocked_los);
+
+                los_cache_.actor_round_nr = actor_round_nr;
+        }
+        else if (player_p == los_cache_.player_p)
+        {
+                return;
+        }
+
+        los_cache_.player_p = player_p;
+
+        std::fill_n(*los_cache_.is_los_to_player_set, nr_map_cells, false);
+}
+
+bool is_seeing_player(const Mon& mon)
+{
+        const P& p = mon.pos;
+
+        LosResult& los = los_cache_.los_to_player[p.x][p.y];
+
+        bool& is_set = los_cache_.is_los_to_player_set[p.x][p.y];
+
+        if (!is_set)
+        {
+                los = fov::check_cell(p,
+                                      los_cache_.player_p,
+                                      los_cache_.blocked_los);
+
+                is_set = true;
+        }
+
+        return mon.can_see_actor(*map::player, los);
+}
+
 // Returns all free positions around the acting monster that is closer to the
 // player than the monster's current position
 std::vector<P> move_bucket(Mon& mon)
@@ -259,19 +337,20 @@ bool make_room_for_friend(Mon& mon)
                 return false;
         }
 
-        bool blocked_los[map_w][map_h];
+        update_los_cache();
 
-        map_parsers::BlocksLos()
-                .run(blocked_los);
-
-        if (!mon.can_see_actor(*map::player, blocked_los))
+        if (!is_seeing_player(mon))
         {
                 return false;
         }
 
         const P& player_p = map::player->pos;
 
-        // Check if there is an allied monster that we should move away for
+        // Allied monsters which we may need to move away for, and whether they
+        // are seeing the player (evaluated once, instead of once for each of
+        // our possible target positions)
+        std::vector< std::pair<Mon*, bool> > friends;
+
         for (Actor* other_actor : game_time::actors)
         {
                 if (other_actor != &mon &&
@@ -281,106 +360,100 @@ bool make_room_for_friend(Mon& mon)
                 {
                         Mon* const other_mon = static_cast<Mon*>(other_actor);
 
-                        const bool is_other_adj =
-                                is_pos_adj(mon.pos, other_mon->pos, false);
-
                         // TODO: It's probably better to check LOS than vision
                         // here? We don't want to move out of the way for a
                         // blind monster.
-                        const bool is_other_seeing_player =
-                                other_mon->can_see_actor(*map::player,
-                                                         blocked_los);
-
-                        /*
-                          Do we have this situation?
-                          #####
-                          #.A.#
-                          #@#B#
-                          #####
-                        */
-                        const bool is_other_adj_with_no_player_los =
-                                is_other_adj && !is_other_seeing_player;
-
-                        // We consider moving out of the way if the other
-                        // monster EITHER:
-                        //  * Is seeing the player and we are blocking it, OR
-                        //  * Is adjacent to us, and is not seeing the player.
-                        const bool is_between =
-                                is_pos_on_line(mon.pos,
-                                               other_mon->pos,
-                                               player_p);
-
-                        if ((is_other_seeing_player && is_between) ||
-                            is_other_adj_with_no_player_los)
+                        friends.push_back(
+                                {other_mon, is_seeing_player(*other_mon)});
+                }
+        }
+
+        // Check if there is an allied monster that we should move away for
+        for (const auto& other : friends)
+        {
+                const Mon* const other_mon = other.first;
+
+                const bool is_other_seeing_player = other.second;
+
+                const bool is_other_adj =
+                        is_pos_adj(mon.pos, other_mon->pos, false);
+
+                /*
+                  Do we have this situation?
+                  #####
+                  #.A.#
+                  #@#B#
+                  #####
+                */
+                const bool is_other_adj_with_no_player_los =
+                        is_other_adj && !is_other_seeing_player;
+
+                // We consider moving out of the way if the other monster
+                // EITHER:
+                //  * Is seeing the player and we are blocking it, OR
+                //  * Is adjacent to us, and is not seeing the player.
+                const bool is_between =
+                        is_other_seeing_player &&
+                        is_pos_on_line(mon.pos, other_mon->pos, player_p);
+
+                if (!is_between && !is_other_adj_with_no_player_los)
+                {
+                        continue;
+                }
+
+                // We are blocking a friend! Try to find an adjacent free cell,
+                // which:
+                // * Is NOT further away from the player than our current
+                //   position, and
+                // * Is not also blocking another monster
+
+                // NOTE: We do not care whether the target cell has LOS to the
+                // player or not. If we move into a cell without LOS, it will
+                // appear as if we are dodging in and out of cover. It lets us
+                // move towards the player with less time in the player's LOS,
+                // and allows blocked ranged monsters to shoot at the player.
+
+                // Get a list of neighbouring free cells
+                auto pos_bucket = move_bucket(mon);
+
+                // Sort the list by distance to player
+                IsCloserToPos cmp(player_p);
+                sort(pos_bucket.begin(), pos_bucket.end(), cmp);
+
+                // Try to find a position not blocking a third allied monster
+                for (const auto& target_p : pos_bucket)
+                {
+                        bool is_p_ok = true;
+
+                        // NOTE: The third monster here can include the original
+                        // blocked "other" monster, since we must also check if
+                        // we block that monster from the target position
+                        for (const auto& third : friends)
                         {
-                                // We are blocking a friend! Try to find an
-                                // adjacent free cell, which:
-                                // * Is NOT further away from the player than
-                                //   our current position, and
-                                // * Is not also blocking another monster
-
-                                // NOTE: We do not care whether the target cell
-                                // has LOS to the player or not. If we move into
-                                // a cell without LOS, it will appear as if we
-                                // are dodging in and out of cover. It lets us
-                                // move towards the player with less time in the
-                                // player's LOS, and allows blocked ranged
-                                // monsters to shoot at the player.
-
-                                // Get a list of neighbouring free cells
-                                auto pos_bucket = move_bucket(mon);
-
-                                // Sort the list by distance to player
-                                IsCloserToPos cmp(player_p);
-                                sort(pos_bucket.begin(), pos_bucket.end(), cmp);
-
-                                // Try to find a position not blocking a third
-                                // allied monster
-                                for (const auto& target_p : pos_bucket)
+                                // TODO: We also need to check that we don't
+                                //       move into a cell which is adjacent to
+                                //       a third monster, who does not have LOS
+                                //       to player! As it is now, we may move
+                                //       out of the way for one such monster,
+                                //       only to block another in the same way!
+                                if (third.second &&
+                                    is_pos_on_line(target_p,
+                                                   third.first->pos,
+                                                   player_p))
                                 {
-                                        bool is_p_ok = true;
-
-                                        for (Actor* actor3 : game_time::actors)
-                                        {
-                                                // NOTE: The third actor here can include the original
-                                                // blocked "other" actor, since we must also check if we
-                                                // block that actor from the target position
-                                                if (actor3 != &mon &&
-                                                    actor3->is_alive() &&
-                                                    !actor3->is_player() &&
-                                                    !map::player->is_leader_of(actor3))
-                                                {
-                                                        Mon* const mon3 = static_cast<Mon*>(actor3);
-
-                                                        const bool other_is_seeing_player =
-                                                                mon3->can_see_actor(*map::player, blocked_los);
-
-                                                        // TODO: We also need to check that we don't move
-                                                        //       into a cell which is adjacent to a third
-                                                        //       monster, who does not have LOS to player!
-                                                        //       As it is now, we may move out of the way
-                                                        //       for one such monster, only to block
-                                                        //       another in the same way!
-
-                                                        if (other_is_seeing_player &&
-                                                            is_pos_on_line(target_p, mon3->pos, player_p))
-                                                        {
-                                                                is_p_ok = false;
-                                                                break;
-                                                        }
-                                                }
-                                        }
-
-                                        if (is_p_ok)
-                                        {
-                                                const P offset = target_p - mon.pos;
-
-                                                mon.move(dir_utils::dir(offset));
-
-                                                return true;
-                                        }
+                                        is_p_ok = false;
+                                        break;
                                 }
                         }
+
+                        if (is_p_ok)
+                        {
+                                const P offset = target_p - mon.pos;
+
+                                mon.move(dir_utils::dir(offset));
+
+                                return true;
+                        }
                 }
         }
 
@@ -592,21 +665,21 @@ bool look(Mon& mon)
 
                         if (become_aware)
                         {
-                                map::update_vision();
+                                map::request_vision_update();
 
                                 mon.become_aware_player(true);
                         }
                         // Not aware, just become wary if non-critical fail
                         else if (is_non_critical_fail)
                         {
-                                map::update_vision();
+                                map::request_vision_update();
 
                                 mon.become_wary_player();
                         }
                 }
                 else // Other actor is monster
                 {
-                        map::update_vision();
+                        map::request_vision_update();
 
                         mon.become_aware_player(false);
                 }
@@ -655,6 +728,8 @@ std::vector<P> find_path_to_lair_if_no_los(Mon& mon, const P& lair_p)
                 .run(blocked,
                      MapParseMode::append);
 
+        perf_stats::Measure perf_measure(PerfCounter::pathfind);
+
         pathfind(mon.pos,
                  lair_p,
                  blocked,
@@ -706,6 +781,8 @@ std::vector<P> find_path_to_leader(Mon& mon)
                 .run(blocked,
                      MapParseMode::append);
 
+        perf_stats::Measure perf_measure(PerfCounter::pathfind);
+
         pathfind(mon.pos,
                  leader->pos,
                  blocked,
@@ -817,6 +894,8 @@ std::vector<P> find_path_to_target(Mon& mon)
                      MapParseMode::append);
 
         // Find a path
+        perf_stats::Measure perf_measure(PerfCounter::pathfind);
+
         pathfind(mon.pos,
                  target.pos,
                  blocked,
@@ -0,0 +1,139 @@
+#include "area_query.hpp"
+
+#include <algorithm>
+
+#include "actor.hpp"
+#include "game_time.hpp"
+#include "line_calc.hpp"
+
+// -----------------------------------------------------------------------------
+// Actor grid
+// -----------------------------------------------------------------------------
+ActorGrid::ActorGrid()
+{
+        std::fill_n(*living_actors_, nr_map_cells, nullptr);
+
+        std::fill_n(*corpse_head_, nr_map_cells, -1);
+
+        // The actor list is traversed backwards, so that pushing to the front
+        // of each corpse list gives the same order as the actor list (and so
+        // that the last living actor in the list wins, if several are stacked)
+        for (auto it = game_time::actors.rbegin();
+             it != game_time::actors.rend();
+             ++it)
+        {
+                Actor* const actor = *it;
+
+                const P& p = actor->pos;
+
+                if (actor->is_alive())
+                {
+                        if (!living_actors_[p.x][p.y])
+                        {
+                                living_actors_[p.x][p.y] = actor;
+                        }
+                }
+                else if (actor->is_corpse())
+                {
+                        corpses_.push_back(actor);
+
+                        corpse_next_.push_back(corpse_head_[p.x][p.y]);
+
+                        corpse_head_[p.x][p.y] = (int)corpses_.size() - 1;
+                }
+        }
+}
+
+// -----------------------------------------------------------------------------
+// area_query
+// -----------------------------------------------------------------------------
+namespace area_query
+{
+
+std::vector< std::vector<P> > cells_in_los(
+        const R& area,
+        const P& origin,
+        const bool blocked[map_w][map_h])
+{
+        std::vector< std::vector<P> > out;
+
+        // Reused for lines which are too long for the precalculated FOV lines
+        std::vector<P> line_buffer;
+
+        for (int y = area.p0.y; y <= area.p1.y; ++y)
+        {
+                for (int x = area.p0.x; x <= area.p1.x; ++x)
+                {
+                        const P p(x, y);
+
+                        const int dist = king_dist(p, origin);
+
+                        bool is_reached = true;
+
+                        if (dist > 1)
+                        {
+                                const P delta(p - origin);
+
+                                const std::vector<P>* delta_line =
+                                        line_calc::fov_delta_line(
+                                                delta,
+                                                fov_max_radi_db);
+
+                                if (!delta_line)
+                                {
+                                        line_buffer =
+                                                line_calc::calc_new_line(
+                                                        P(0, 0),
+                                                        delta,
+                                                        true,
+                                                        999,
+                                                        true);
+
+                                        delta_line = &line_buffer;
+                                }
+
+                                for (const P& d : *delta_line)
+                                {
+                                        const P p_check(origin + d);
+
+                                        if (blocked[p_check.x][p_check.y])
+                                        {
+                                                is_reached = false;
+
+                                                break;
+                                        }
+                                }
+                        }
+
+                        if (is_reached)
+                        {
+                                if ((int)out.size() <= dist)
+                                {
+                                        out.resize(dist + 1);
+                                }
+
+                                out[dist].push_back(p);
+                        }
+                }
+        }
+
+        return out;
+}
+
+std::vector<Actor*> living_actors_within(const P& origin, const int radi)
+{
+        std::vector<Actor*> out;
+
+        for (Actor* const actor : game_time::actors)
+        {
+                if (actor->is_alive() &&
+                    (king_dist(origin, actor->pos) <= radi))
+                {
+                        out.push_back(actor);
+                }
+        }
+
+        return out;
+}
+
+} // area_query
@@ -1335,6 +1335,8 @@ void melee(Actor* const attacker,
            Actor& defender,
            Wpn& wpn)
 {
+        rnd::StreamScope rnd_stream(rnd::Stream::combat);
+
         map::update_vision();
 
         const MeleeAttData att_data(attacker, defender, wpn);
@@ -1480,6 +1482,8 @@ DidAction ranged(Actor* const attacker,
                  const P& aim_pos,
                  Wpn& wpn)
 {
+        rnd::StreamScope rnd_stream(rnd::Stream::combat);
+
         map::update_vision();
 
         DidAction did_attack = DidAction::no;
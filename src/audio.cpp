@@ -353,6 +353,8 @@ void play(const SfxId sfx,
 
 void try_play_amb(const int one_in_n_chance_to_play)
 {
+    rnd::StreamScope rnd_stream(rnd::Stream::cosmetic);
+
     //
     // NOTE: The ambient sound effect will be loaded by play(), if not already
     //       loaded (only the action sound effects are pre-loaded)
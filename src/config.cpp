@@ -53,6 +53,7 @@ int delay_shotgun_ = -1;
 int delay_explosion_ = -1;
 std::string default_player_name_ = "";
 bool is_bot_playing_ = false;
+bool is_turbo_mode_ = false;
 bool is_audio_enabled_ = false;
 bool is_amb_audio_enabled_ = false;
 bool is_tiles_mode_ = false;
@@ -532,6 +533,7 @@ void init()
 {
         font_name_ = "";
         is_bot_playing_ = false;
+        is_turbo_mode_ = false;
 
         set_default_variables();
 
@@ -604,6 +606,16 @@ void toggle_bot_playing()
         is_bot_playing_ = !is_bot_playing_;
 }
 
+bool is_turbo_mode()
+{
+        return is_turbo_mode_;
+}
+
+void toggle_turbo_mode()
+{
+        is_turbo_mode_ = !is_turbo_mode_;
+}
+
 bool is_light_explosive_prompt()
 {
         return is_light_explosive_prompt_;
@@ -714,10 +726,6 @@ void ConfigState::update()
         case MenuAction::esc:
         case MenuAction::space:
         {
-                // Since text mode wall symbol may have changed, we need to
-                // redefine the feature data list
-                feature_data::init();
-
                 states::pop();
 
                 return;
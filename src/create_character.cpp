@@ -177,7 +177,7 @@ void PickBgState::draw()
                         continue;
                 }
 
-                const auto formatted_lines = text_format::split(
+                const auto& formatted_lines = text_format::split_cached(
                         descr_entry.str,
                         panels::get_w(Panel::create_char_descr));
 
@@ -407,8 +407,8 @@ void PickTraitState::draw()
 
         std::string descr = player_bon::trait_descr(trait_marked);
 
-        const auto formatted_descr =
-                text_format::split(
+        const auto& formatted_descr =
+                text_format::split_cached(
                         descr,
                         panels::get_w(Panel::create_char_descr));
 
@@ -8,6 +8,7 @@
 #include "feature_rigid.hpp"
 #include "feature_mob.hpp"
 #include "feature_door.hpp"
+#include "perf_stats.hpp"
 
 // -----------------------------------------------------------------------------
 // Private
@@ -15,6 +16,16 @@
 static CellRenderData render_array[map_w][map_h];
 static CellRenderData render_array_player_memory[map_w][map_h];
 
+// The render data last drawn to the io map layer for each cell - the current
+// render array is compared against this, and only differing cells are drawn
+static CellRenderData render_array_drawn[map_w][map_h];
+
+// Set to false when the drawn render array no longer reflects the content of
+// the map layer, to force drawing all cells in the next frame
+static bool is_render_array_drawn_valid = false;
+
+static draw_map::Stats stats_;
+
 static void clear_render_array()
 {
         for (int x = 0; x < map_w; ++x)
@@ -378,41 +389,81 @@ void set_unseen_cells_from_player_memory()
         }
 }
 
+static void draw_cell(const CellRenderData& render_data, const P& pos)
+{
+        // NOTE: It can happen that text is drawn on the map even in tiles
+        // mode - for example exclamation marks on cells with known, unseen
+        // actors
+        if (config::is_tiles_mode() &&
+            (render_data.tile != TileId::empty))
+        {
+                io::draw_tile(
+                        render_data.tile,
+                        Panel::map,
+                        pos,
+                        render_data.color,
+                        render_data.color_bg);
+        }
+        else if ((render_data.character != 0) &&
+                 (render_data.character != ' '))
+        {
+                io::draw_character(
+                        render_data.character,
+                        Panel::map,
+                        pos,
+                        render_data.color,
+                        render_data.color_bg);
+        }
+        else // Nothing to draw
+        {
+                // The map layer keeps whatever was drawn here previously
+                io::cover_cell(Panel::map, pos);
+        }
+}
+
 static void draw_render_array()
 {
+        const bool is_layer_retained = io::begin_map_layer();
+
+        const bool is_redraw_all =
+                !is_layer_retained ||
+                !is_render_array_drawn_valid;
+
+        int nr_cells_drawn = 0;
+
         for (int x = 0; x < map_w; ++x)
         {
                 for (int y = 0; y < map_h; ++y)
                 {
-                        auto& render_data = render_array[x][y];
+                        const auto& render_data = render_array[x][y];
 
-                        const P pos(x, y);
+                        auto& drawn_render_data = render_array_drawn[x][y];
 
-                        // NOTE: It can happen that text is drawn on the map
-                        // even in tiles mode - for example exclamation marks on
-                        // cells with known, unseen actors
-                        if (config::is_tiles_mode() &&
-                            (render_data.tile != TileId::empty))
-                        {
-                                io::draw_tile(
-                                        render_data.tile,
-                                        Panel::map,
-                                        pos,
-                                        render_data.color,
-                                        render_data.color_bg);
-                        }
-                        else if ((render_data.character != 0) &&
-                                 (render_data.character != ' '))
+                        if (!is_redraw_all &&
+                            (render_data == drawn_render_data))
                         {
-                                io::draw_character(
-                                        render_data.character,
-                                        Panel::map,
-                                        pos,
-                                        render_data.color,
-                                        render_data.color_bg);
+                                continue;
                         }
+
+                        draw_cell(render_data, P(x, y));
+
+                        drawn_render_data = render_data;
+
+                        ++nr_cells_drawn;
                 }
         }
+
+        io::end_map_layer();
+
+        io::blit_map_layer();
+
+        is_render_array_drawn_valid = true;
+
+        stats_.nr_cells_drawn_last_frame = nr_cells_drawn;
+        stats_.nr_cells_drawn += nr_cells_drawn;
+        ++stats_.nr_frames;
+
+        TRACE_VERBOSE << "Map cells drawn: " << nr_cells_drawn << std::endl;
 }
 
 static int lifebar_length(const Actor& actor)
@@ -553,10 +604,14 @@ void clear()
                         render_array_player_memory[x][y] = CellRenderData();
                 }
         }
+
+        is_render_array_drawn_valid = false;
 }
 
 void run()
 {
+        perf_stats::Measure perf_measure(PerfCounter::draw_map);
+
         clear_render_array();
 
         set_unseen_cells_from_player_memory();
@@ -597,4 +652,14 @@ const CellRenderData& get_drawn_cell_player_memory(int x, int y)
         return render_array_player_memory[x][y];
 }
 
+const Stats& stats()
+{
+        return stats_;
+}
+
+void reset_stats()
+{
+        stats_ = Stats();
+}
+
 } // draw_map
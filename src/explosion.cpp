@@ -5,7 +5,7 @@
 #include "msg_log.hpp"
 #include "map_parsing.hpp"
 #include "sdl_base.hpp"
-#include "line_calc.hpp"
+#include "area_query.hpp"
 #include "actor_player.hpp"
 #include "sdl_base.hpp"
 #include "player_bon.hpp"
@@ -24,54 +24,13 @@ std::vector< std::vector<P> > cells_reached(
     const ExplExclCenter exclude_center,
     bool blocked[map_w][map_h])
 {
-    std::vector< std::vector<P> > out;
+    auto out = area_query::cells_in_los(area, origin, blocked);
 
-    for (int y = area.p0.y; y <= area.p1.y; ++y)
+    // The center is the only cell at distance zero
+    if ((exclude_center == ExplExclCenter::yes) &&
+        !out.empty())
     {
-        for (int x = area.p0.x; x <= area.p1.x; ++x)
-        {
-            const P pos(x, y);
-
-            if (exclude_center == ExplExclCenter::yes &&
-                pos == origin)
-            {
-                continue;
-            }
-
-            const int dist = king_dist(pos, origin);
-
-            bool is_reached = true;
-
-            if (dist > 1)
-            {
-                    const auto path =
-                        line_calc::calc_new_line(
-                            origin,
-                            pos,
-                            true,
-                            999,
-                            false);
-
-                for (const P& pos_check_block : path)
-                {
-                    if (blocked[pos_check_block.x][pos_check_block.y])
-                    {
-                        is_reached = false;
-                        break;
-                    }
-                }
-            }
-
-            if (is_reached)
-            {
-                if ((int)out.size() <= dist)
-                {
-                    out.resize(dist + 1);
-                }
-
-                out[dist].push_back(pos);
-            }
-        }
+        out[0].clear();
     }
 
     return out;
@@ -188,32 +147,7 @@ void run(const P& origin,
     draw(pos_lists, blocked, color_override);
 
     // Do damage, apply effect
-    Actor* living_actors[map_w][map_h];
-
-    std::vector<Actor*> corpses[map_w][map_h];
-
-    for (int x = 0; x < map_w; ++x)
-    {
-        for (int y = 0; y < map_h; ++y)
-        {
-            living_actors[x][y] = nullptr;
-            corpses[x][y].clear();
-        }
-    }
-
-    for (Actor* actor : game_time::actors)
-    {
-        const P& pos = actor->pos;
-
-        if (actor->is_alive())
-        {
-            living_actors[pos.x][pos.y] = actor;
-        }
-        else if (actor->is_corpse())
-        {
-            corpses[pos.x][pos.y].push_back(actor);
-        }
-    }
+    const ActorGrid actor_grid;
 
     const int nr_outer = pos_lists.size();
 
@@ -223,9 +157,7 @@ void run(const P& origin,
 
         for (const P& pos : positions_at_radi)
         {
-            Actor* living_actor = living_actors[pos.x][pos.y];
-
-            std::vector<Actor*> corpses_here = corpses[pos.x][pos.y];
+            Actor* living_actor = actor_grid.living_actor(pos);
 
             if (expl_type == ExplType::expl)
             {
@@ -263,10 +195,10 @@ void run(const P& origin,
                 }
 
                 // Damage dead actors
-                for (Actor* corpse : corpses_here)
+                actor_grid.for_each_corpse(pos, [dmg](Actor* const corpse)
                 {
                     corpse->hit(dmg, DmgType::physical);
-                }
+                });
 
                 // Add smoke
                 if (rnd::fraction(6, 10))
@@ -330,14 +262,14 @@ void run(const P& origin,
                                     DmgMethod::elemental,
                                     nullptr);
 
-                    for (Actor* corpse : corpses_here)
+                    actor_grid.for_each_corpse(pos, [prop](Actor* const corpse)
                     {
                         Prop* const prop_cpy = property_factory::make(prop->id());
 
                         prop_cpy->set_duration(prop->nr_turns_left());
 
                         corpse->properties().apply(prop_cpy);
-                    }
+                    });
                 }
             }
         }
@@ -348,7 +280,7 @@ void run(const P& origin,
         delete prop;
     }
 
-    map::update_vision();
+    map::request_vision_update();
 
 } // run
 
@@ -392,7 +324,7 @@ void run_smoke_explosion_at(const P& origin, const int radi_change)
         }
     }
 
-    map::update_vision();
+    map::request_vision_update();
 }
 
 R explosion_area(const P& c, const int radi)
@@ -27,9 +27,9 @@ bool MoveRules::can_move(const Actor& actor) const
     // This feature blocks normal movement, check if any property overrides this
     // (e.g. flying)
 
-    for (const auto id : props_allow_move_)
+    for (size_t i = 0; i < nr_props_allow_move_; ++i)
     {
-        if (actor.properties().has_prop(id))
+        if (actor.properties().has_prop(props_allow_move_[i]))
         {
             return true;
         }
@@ -44,75 +44,58 @@ bool MoveRules::can_move(const Actor& actor) const
 namespace feature_data
 {
 
-FeatureData data_list[(size_t)FeatureId::END];
-
 namespace
 {
 
-void reset_data(FeatureData& d)
+template<typename T>
+Feature* make(const P& p)
 {
-    d.make_obj = [](const P & p) {(void)p; return nullptr;};
-    d.id = FeatureId::END;
-    d.character = ' ';
-    d.tile = TileId::empty;
-    d.move_rules.reset();
-    d.is_sound_passable = true;
-    d.is_projectile_passable = true;
-    d.is_los_passable = true;
-    d.is_smoke_passable = true;
-    d.can_have_blood = true;
-    d.can_have_gore = false;
-    d.can_have_corpse = true;
-    d.can_have_rigid = true;
-    d.can_have_item = true;
-    d.is_bottomless = false;
-    d.matl_type = Matl::stone;
-    d.msg_on_player_blocked = "The way is blocked.";
-    d.msg_on_player_blocked_blind = "I bump into something.";
-    d.dodge_modifier = 0;
-    d.shock_when_adjacent = 0;
+    return new T(p);
+}
+
+Feature* make_pylon(const P& p)
+{
+    return new Pylon(p, PylonId::any);
 }
 
-void add_to_list_and_reset(FeatureData& d)
+struct FeatureDataList
+{
+    FeatureData data[(size_t)FeatureId::END];
+};
+
+constexpr void add_to_list_and_reset(FeatureDataList& list, FeatureData& d)
 {
-    data_list[(size_t)d.id] = d;
+    list.data[(size_t)d.id] = d;
 
-    reset_data(d);
+    d = FeatureData();
 }
 
-void init_data_list()
+constexpr FeatureDataList make_data_list()
 {
+    FeatureDataList list {};
+
     FeatureData d;
-    reset_data(d);
 
     d.id = FeatureId::floor;
-    d.make_obj = [](const P & p)
-    {
-        return new Floor(p);
-    };
+    d.make_obj = make<Floor>;
     d.character = '.';
     d.tile = TileId::floor;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::stone;
     d.can_have_gore = true;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
 
     d.id = FeatureId::bridge;
-    d.make_obj = [](const P & p)
-    {
-        return new Bridge(p);
-    };
+    d.make_obj = make<Bridge>;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::wood;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::wall;
-    d.make_obj = [](const P & p)
-    {
-        return new Wall(p);
-    };
-    d.character = config::is_text_mode_wall_full_square() ? 10 : '#';
+    d.make_obj = make<Wall>;
+    // NOTE: The text mode wall character depends on the config, see Wall
+    d.character = '#';
     d.tile = TileId::wall_top;
     d.move_rules.set_prop_can_move(PropId::ethereal);
     d.move_rules.set_prop_can_move(PropId::burrowing);
@@ -125,13 +108,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::stone;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::tree;
-    d.make_obj = [](const P & p)
-    {
-        return new Tree(p);
-    };
+    d.make_obj = make<Tree>;
     d.character = '|';
     d.tile = TileId::tree;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -146,37 +126,28 @@ void init_data_list()
     d.msg_on_player_blocked = "There is a tree in the way.";
     d.matl_type = Matl::wood;
     d.shock_when_adjacent = 1;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::grass;
-    d.make_obj = [](const P & p)
-    {
-        return new Grass(p);
-    };
+    d.make_obj = make<Grass>;
     d.character = '.';
     d.tile = TileId::floor;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::plant;
     d.can_have_gore = true;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::bush;
-    d.make_obj = [](const P & p)
-    {
-        return new Bush(p);
-    };
+    d.make_obj = make<Bush>;
     d.character = '"';
     d.tile = TileId::bush;
     d.move_rules.set_can_move_common();
     d.is_los_passable = false;
     d.matl_type = Matl::plant;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::vines;
-    d.make_obj = [](const P & p)
-    {
-        return new Vines(p);
-    };
+    d.make_obj = make<Vines>;
     d.character = '"';
     d.tile = TileId::vines;
     d.move_rules.set_can_move_common();
@@ -185,13 +156,10 @@ void init_data_list()
     d.can_have_gore = false;
     d.matl_type = Matl::plant;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::chains;
-    d.make_obj = [](const P & p)
-    {
-        return new Chains(p);
-    };
+    d.make_obj = make<Chains>;
     d.character = '"';
     d.tile = TileId::chains;
     d.move_rules.set_can_move_common();
@@ -200,13 +168,10 @@ void init_data_list()
     d.can_have_blood = true;
     d.matl_type = Matl::metal;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::grate;
-    d.make_obj = [](const P & p)
-    {
-        return new Grate(p);
-    };
+    d.make_obj = make<Grate>;
     d.character = '#';
     d.tile = TileId::grate;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -219,13 +184,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::metal;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::stairs;
-    d.make_obj = [](const P & p)
-    {
-        return new Stairs(p);
-    };
+    d.make_obj = make<Stairs>;
     d.character = '>';
     d.tile = TileId::stairs_down;
     d.can_have_blood = false;
@@ -234,13 +196,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::stone;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::monolith;
-    d.make_obj = [](const P & p)
-    {
-        return new Monolith(p);
-    };
+    d.make_obj = make<Monolith>;
     d.character = '|';
     d.tile = TileId::monolith;
     d.is_projectile_passable = false;
@@ -252,13 +211,10 @@ void init_data_list()
     d.can_have_item = false;
     d.shock_when_adjacent = 10;
     d.matl_type = Matl::stone;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::pylon;
-    d.make_obj = [](const P & p)
-    {
-        return new Pylon(p, PylonId::any);
-    };
+    d.make_obj = make_pylon;
     d.character = '|';
     d.tile = TileId::pylon;
     d.is_projectile_passable = false;
@@ -270,13 +226,10 @@ void init_data_list()
     d.can_have_item = false;
     d.shock_when_adjacent = 10;
     d.matl_type = Matl::metal;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::lever;
-    d.make_obj = [](const P & p)
-    {
-        return new Lever(p);
-    };
+    d.make_obj = make<Lever>;
     d.character = '%';
     d.tile = TileId::lever_left;
     d.can_have_blood = false;
@@ -285,13 +238,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::metal;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::brazier;
-    d.make_obj = [](const P & p)
-    {
-        return new Brazier(p);
-    };
+    d.make_obj = make<Brazier>;
     d.character = '0';
     d.tile = TileId::brazier;
     d.can_have_blood = false;
@@ -301,13 +251,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::metal;
     d.auto_spawn_placement = FeaturePlacement::away_from_walls;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::liquid_shallow;
-    d.make_obj = [](const P & p)
-    {
-        return new LiquidShallow(p);
-    };
+    d.make_obj = make<LiquidShallow>;
     d.character = '~';
     d.tile = TileId::water1;
     d.move_rules.set_can_move_common();
@@ -316,13 +263,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.dodge_modifier = -10;
     d.matl_type = Matl::fluid;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::liquid_deep;
-    d.make_obj = [](const P & p)
-    {
-        return new LiquidDeep(p);
-    };
+    d.make_obj = make<LiquidDeep>;
     d.character = '~';
     d.tile = TileId::water1;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -331,13 +275,10 @@ void init_data_list()
     d.can_have_gore = false;
     d.can_have_rigid = false;
     d.matl_type = Matl::fluid;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::chasm;
-    d.make_obj = [](const P & p)
-    {
-        return new Chasm(p);
-    };
+    d.make_obj = make<Chasm>;
     d.character = '.';
     d.tile = TileId::floor;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -352,13 +293,10 @@ void init_data_list()
         "I realize I am standing on the edge of a chasm.";
     d.matl_type = Matl::empty;
     d.shock_when_adjacent = 3;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::gravestone;
-    d.make_obj = [](const P & p)
-    {
-        return new GraveStone(p);
-    };
+    d.make_obj = make<GraveStone>;
     d.character = ']';
     d.tile = TileId::grave_stone;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -370,13 +308,10 @@ void init_data_list()
     d.can_have_item = false;
     d.shock_when_adjacent = 2;
     d.matl_type = Matl::stone;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::church_bench;
-    d.make_obj = [](const P & p)
-    {
-        return new ChurchBench(p);
-    };
+    d.make_obj = make<ChurchBench>;
     d.character = '[';
     d.tile = TileId::church_bench;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -390,25 +325,19 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::wood;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::carpet;
-    d.make_obj = [](const P & p)
-    {
-        return new Carpet(p);
-    };
+    d.make_obj = make<Carpet>;
     d.character = '.';
     d.tile = TileId::floor;
     d.can_have_rigid = false;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::cloth;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::rubble_high;
-    d.make_obj = [](const P & p)
-    {
-        return new RubbleHigh(p);
-    };
+    d.make_obj = make<RubbleHigh>;
     d.character = 8;
     d.tile = TileId::rubble_high;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -423,37 +352,28 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.matl_type = Matl::stone;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::rubble_low;
-    d.make_obj = [](const P & p)
-    {
-        return new RubbleLow(p);
-    };
+    d.make_obj = make<RubbleLow>;
     d.character = ',';
     d.tile = TileId::rubble_low;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::bones;
-    d.make_obj = [](const P & p)
-    {
-        return new Bones(p);
-    };
+    d.make_obj = make<Bones>;
     d.character = '&';
     d.tile = TileId::corpse2;
     d.move_rules.set_can_move_common();
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::statue;
-    d.make_obj = [](const P & p)
-    {
-        return new Statue(p);
-    };
+    d.make_obj = make<Statue>;
     d.character = 5; //Paragraph sign
     d.tile = TileId::witch_or_warlock;
     d.is_projectile_passable = false;
@@ -465,13 +385,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::cocoon;
-    d.make_obj = [](const P & p)
-    {
-        return new Cocoon(p);
-    };
+    d.make_obj = make<Cocoon>;
     d.character = '8';
     d.tile = TileId::cocoon_closed;
     d.is_projectile_passable = true;
@@ -484,13 +401,10 @@ void init_data_list()
     d.shock_when_adjacent = 3;
     d.matl_type = Matl::cloth;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::chest;
-    d.make_obj = [](const P & p)
-    {
-        return new Chest(p);
-    };
+    d.make_obj = make<Chest>;
     d.character = '+';
     d.tile = TileId::chest_closed;
     d.can_have_blood = false;
@@ -499,13 +413,10 @@ void init_data_list()
     d.can_have_rigid = false;
     d.can_have_item = false;
     d.auto_spawn_placement = FeaturePlacement::adj_to_walls;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::cabinet;
-    d.make_obj = [](const P & p)
-    {
-        return new Cabinet(p);
-    };
+    d.make_obj = make<Cabinet>;
     d.character = '7';
     d.tile = TileId::cabinet_closed;
     d.is_projectile_passable = false;
@@ -517,13 +428,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::wood;
     d.auto_spawn_placement = FeaturePlacement::adj_to_walls;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::bookshelf;
-    d.make_obj = [](const P & p)
-    {
-        return new Bookshelf(p);
-    };
+    d.make_obj = make<Bookshelf>;
     d.character = '7';
     d.tile = TileId::bookshelf_full;
     d.is_projectile_passable = false;
@@ -535,13 +443,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::wood;
     d.auto_spawn_placement = FeaturePlacement::adj_to_walls;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::alchemist_bench;
-    d.make_obj = [](const P & p)
-    {
-        return new AlchemistBench(p);
-    };
+    d.make_obj = make<AlchemistBench>;
     d.character = '7';
     d.tile = TileId::alchemist_bench_full;
     d.is_projectile_passable = false;
@@ -553,13 +458,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::wood;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::fountain;
-    d.make_obj = [](const P & p)
-    {
-        return new Fountain(p);
-    };
+    d.make_obj = make<Fountain>;
     d.character = '1';
     d.tile = TileId::fountain;
     d.is_projectile_passable = false;
@@ -571,13 +473,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::away_from_walls;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::stalagmite;
-    d.make_obj = [](const P & p)
-    {
-        return new Stalagmite(p);
-    };
+    d.make_obj = make<Stalagmite>;
     d.character = ':';
     d.tile = TileId::stalagmite;
     d.is_projectile_passable = false;
@@ -589,13 +488,10 @@ void init_data_list()
     d.can_have_item = false;
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::altar;
-    d.make_obj = [](const P & p)
-    {
-        return new Altar(p);
-    };
+    d.make_obj = make<Altar>;
     d.character = '_';
     d.tile = TileId::altar;
     d.can_have_blood = false;
@@ -606,13 +502,10 @@ void init_data_list()
     d.shock_when_adjacent = 10;
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::tomb;
-    d.make_obj = [](const P & p)
-    {
-        return new Tomb(p);
-    };
+    d.make_obj = make<Tomb>;
     d.character = ']';
     d.tile = TileId::tomb_closed;
     d.move_rules.set_prop_can_move(PropId::ethereal);
@@ -625,34 +518,25 @@ void init_data_list()
     d.shock_when_adjacent = 10;
     d.matl_type = Matl::stone;
     d.auto_spawn_placement = FeaturePlacement::either;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::door;
-    d.make_obj = [](const P & p)
-    {
-        return new Door(p);
-    };
+    d.make_obj = make<Door>;
     d.can_have_blood = false;
     d.can_have_gore = false;
     d.can_have_corpse = false;
     d.can_have_rigid = false;
     d.can_have_item = false;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::trap;
-    d.make_obj = [](const P & p)
-    {
-        return new Trap(p);
-    };
+    d.make_obj = make<Trap>;
     d.move_rules.set_can_move_common();
     d.can_have_rigid = false;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::lit_dynamite;
-    d.make_obj = [](const P & p)
-    {
-        return new LitDynamite(p);
-    };
+    d.make_obj = make<LitDynamite>;
     d.character = '/';
     d.tile = TileId::dynamite_lit;
     d.move_rules.set_can_move_common();
@@ -660,68 +544,51 @@ void init_data_list()
     d.can_have_gore = false;
     d.can_have_corpse = false;
     d.can_have_item = false;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::lit_flare;
-    d.make_obj = [](const P & p)
-    {
-        return new LitFlare(p);
-    };
+    d.make_obj = make<LitFlare>;
     d.character = '/';
     d.tile = TileId::flare_lit;
     d.move_rules.set_can_move_common();
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::smoke;
-    d.make_obj = [](const P & p)
-    {
-        return new Smoke(p);
-    };
+    d.make_obj = make<Smoke>;
     d.character = '*';
     d.tile = TileId::smoke;
     d.move_rules.set_can_move_common();
     d.is_los_passable = false;
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::event_wall_crumble;
-    d.make_obj = [](const P & p)
-    {
-        return new EventWallCrumble(p);
-    };
+    d.make_obj = make<EventWallCrumble>;
     d.move_rules.set_can_move_common();
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::event_snake_emerge;
-    d.make_obj = [](const P & p)
-    {
-        return new EventSnakeEmerge(p);
-    };
+    d.make_obj = make<EventSnakeEmerge>;
     d.move_rules.set_can_move_common();
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
 
     d.id = FeatureId::event_rat_cave_discovery;
-    d.make_obj = [](const P & p)
-    {
-        return new EventRatsInTheWallsDiscovery(p);
-    };
+    d.make_obj = make<EventRatsInTheWallsDiscovery>;
     d.move_rules.set_can_move_common();
-    add_to_list_and_reset(d);
+    add_to_list_and_reset(list, d);
+
+    return list;
 }
 
-} // namespace
+// NOTE: Built entirely at compile time, no initialization is needed
+constexpr FeatureDataList data_list_ = make_data_list();
 
-void init()
-{
-    TRACE_FUNC_BEGIN;
-    init_data_list();
-    TRACE_FUNC_END;
-}
+} // namespace
 
 const FeatureData& data(const FeatureId id)
 {
     ASSERT(id != FeatureId::END);
-    ASSERT(id != FeatureId::END);
-    return data_list[int(id)];
+
+    return data_list_.data[(size_t)id];
 }
 
 } // feature_data
@@ -26,9 +26,27 @@
 #include "property_data.hpp"
 #include "property_handler.hpp"
 
+// -----------------------------------------------------------------------------
+// Private
+// -----------------------------------------------------------------------------
+// Enough blocks per chunk for most rigids of the same size on a map
+static BlockPool rigid_pool_(512);
+
 // -----------------------------------------------------------------------------
 // Rigid
 // -----------------------------------------------------------------------------
+void* Rigid::operator new(const size_t size)
+{
+    return rigid_pool_.allocate(size);
+}
+
+// NOTE: Since the destructor is virtual, the size is the size of the dynamic
+// type, i.e. the same size which was requested when allocating
+void Rigid::operator delete(void* const ptr, const size_t size)
+{
+    rigid_pool_.free(ptr, size);
+}
+
 Rigid::Rigid(const P& p) :
     Feature(p),
     item_container_(),
@@ -33,6 +33,9 @@ LosResult check_cell(const P& p0,
                       const P& p1,
                       const bool hard_blocked[map_w][map_h])
 {
+    // The light map must be up to date
+    map::update_vision_if_stale();
+
     LosResult los_result;
 
     los_result.is_blocked_hard = true; // Assume we are blocked initially
@@ -48,6 +48,7 @@
 #include "property.hpp"
 #include "property_data.hpp"
 #include "property_handler.hpp"
+#include "perf_stats.hpp"
 
 namespace game
 {
@@ -288,6 +289,24 @@ void handle_player_input(const InputData& input)
     }
     break;
 
+    // Turn performance stats overlay and log
+    case SDLK_F10:
+    {
+        perf_stats::toggle();
+    }
+    break;
+
+    // Turbo mode (no animations, delays or more prompts)
+    case SDLK_F11:
+    {
+        config::toggle_turbo_mode();
+
+        msg_log::add(config::is_turbo_mode() ?
+                     "Turbo mode enabled." :
+                     "Turbo mode disabled.");
+    }
+    break;
+
     // Options
     case '=':
     {
@@ -1168,11 +1187,15 @@ void GameState::on_start()
 
 void GameState::draw()
 {
+    map::update_vision_if_stale();
+
     draw_map::run();
 
     status_lines::draw();
 
     msg_log::draw();
+
+    perf_stats::draw();
 }
 
 void GameState::update()
@@ -22,6 +22,8 @@
 #include "msg_log.hpp"
 #include "property_data.hpp"
 #include "property_handler.hpp"
+#include "sound.hpp"
+#include "perf_stats.hpp"
 
 // -----------------------------------------------------------------------------
 // Private
@@ -36,6 +38,8 @@ static size_t current_actor_idx_ = 0;
 
 static int turn_nr_ = 0;
 
+static int actor_round_nr_ = 0;
+
 static int std_turn_delay_ = ticks_per_turn_;
 
 static void run_std_turn_events()
@@ -55,6 +59,8 @@ static void run_std_turn_events()
                 return;
         }
 
+        perf_stats::end_turn();
+
         ++turn_nr_;
 
         // NOTE: Iteration must be done by index, since new monsters may be
@@ -219,6 +225,7 @@ void init()
         current_turn_type_pos_ = 0;
         current_actor_idx_ = 0;
         turn_nr_ = 0;
+        ++actor_round_nr_;
         std_turn_delay_ = ticks_per_turn_;
 
         actors.clear();
@@ -261,6 +268,11 @@ int turn_nr()
         return turn_nr_;
 }
 
+int actor_round_nr()
+{
+        return actor_round_nr_;
+}
+
 void mobs_at_pos(const P& p, std::vector<Mob*>& vector_ref)
 {
         vector_ref.clear();
@@ -335,10 +347,23 @@ void add_actor(Actor* actor)
 void reset_turn_type_and_actor_counters()
 {
         current_turn_type_pos_ = current_actor_idx_ = 0;
+
+        ++actor_round_nr_;
 }
 
 void tick(const int speed_pct_diff)
 {
+        PROFILE_SCOPE(__func__);
+
+        perf_stats::Measure perf_measure(PerfCounter::tick);
+
+        // Vision changes requested during the action must not leak into the
+        // next actor's turn
+        map::update_vision_if_stale();
+
+        // Let monsters hear all sounds emitted during the action
+        snd_emit::run_pending_snds();
+
         auto* actor = current_actor();
 
         {
@@ -388,6 +413,8 @@ void tick(const int speed_pct_diff)
                         }
 
                         current_actor_idx_ = 0;
+
+                        ++actor_round_nr_;
                 }
 
                 actor = current_actor();
@@ -409,10 +436,15 @@ void tick(const int speed_pct_diff)
         current_actor()->properties().on_turn_begin();
 
         current_actor()->on_actor_turn();
+
+        // Sounds may have been emitted by turn events
+        snd_emit::run_pending_snds();
 }
 
 void update_light_map()
 {
+        perf_stats::Measure perf_measure(PerfCounter::update_light_map);
+
         bool light_tmp[map_w][map_h] = {};
 
         for (const auto* const a : actors)
@@ -87,43 +87,446 @@ namespace highscore
 namespace
 {
 
-void sort_entries(std::vector<HighscoreEntry>& entries)
+const std::string log_path = "res/data/highscores.bin";
+
+const std::string index_path = "res/data/highscores_index.bin";
+
+// Text format used by earlier versions, converted to the log on startup
+const std::string legacy_path = "res/data/highscores";
+
+// "IAHS" (IA Highscores)
+const uint32_t log_magic = 0x53484149;
+
+// "IAHI" (IA Highscore Index)
+const uint32_t index_magic = 0x49484149;
+
+const uint32_t format_version = 1;
+
+// Magic and version
+const size_t log_header_size = 8;
+
+// Magic, version, log size, and number of entries
+const size_t index_header_size = 16;
+
+// Score and log offset
+const size_t index_entry_size = 8;
+
+// The sorted index, and the size of the log it was built from - if this does
+// not match the log file, the index is rebuilt by scanning the log
+struct Index
+{
+        std::vector<HighscoreIdxEntry> entries;
+
+        uint32_t log_size;
+};
+
+void put_u32(std::string& dst, const uint32_t v)
+{
+        for (int i = 0; i < 4; ++i)
+        {
+                dst.push_back((char)((v >> (i * 8)) & 0xFF));
+        }
+}
+
+uint32_t get_u32(const char* const src)
 {
-        auto cmp = [](const HighscoreEntry & e1, const HighscoreEntry & e2)
+        uint32_t v = 0;
+
+        for (int i = 0; i < 4; ++i)
+        {
+                v |= (uint32_t)(uint8_t)src[i] << (i * 8);
+        }
+
+        return v;
+}
+
+void put_str(std::string& dst, const std::string& str)
+{
+        put_u32(dst, str.size());
+
+        dst += str;
+}
+
+// Reads the fields of a log record in order - "is_ok" is cleared if a field
+// goes past the end of the record
+class RecordReader
+{
+public:
+        RecordReader(const std::string& record) :
+                is_ok   (true),
+                record_ (record),
+                pos_    (0) {}
+
+        uint32_t u32()
+        {
+                if ((pos_ + 4) > record_.size())
                 {
-                        return e1.score() > e2.score();
-                };
+                        is_ok = false;
 
-        sort(entries.begin(), entries.end(), cmp);
+                        return 0;
+                }
+
+                const uint32_t v = get_u32(record_.data() + pos_);
+
+                pos_ += 4;
+
+                return v;
+        }
+
+        std::string str()
+        {
+                const size_t len = u32();
+
+                if (!is_ok || ((pos_ + len) > record_.size()))
+                {
+                        is_ok = false;
+
+                        return "";
+                }
+
+                const std::string str = record_.substr(pos_, len);
+
+                pos_ += len;
+
+                return str;
+        }
+
+        bool is_ok;
+
+private:
+        const std::string& record_;
+        size_t pos_;
+};
+
+// Record size, followed by the fields
+std::string encode_record(const HighscoreEntry& entry)
+{
+        std::string fields;
+
+        put_str(fields, entry.game_summary_file_path());
+        put_str(fields, entry.date());
+        put_str(fields, entry.name());
+        put_u32(fields, (uint32_t)entry.xp());
+        put_u32(fields, (uint32_t)entry.lvl());
+        put_u32(fields, (uint32_t)entry.dlvl());
+        put_u32(fields, (uint32_t)entry.turn_count());
+        put_u32(fields, (uint32_t)entry.ins());
+        put_u32(fields, (uint32_t)entry.is_win());
+        put_u32(fields, (uint32_t)entry.bg());
+
+        std::string record;
+
+        put_u32(record, fields.size());
+
+        record += fields;
+
+        return record;
 }
 
-void write_file(std::vector<HighscoreEntry>& entries)
+HighscoreEntry decode_record(const std::string& record, bool& is_ok)
 {
-        std::ofstream file;
+        RecordReader reader(record);
+
+        // NOTE: The order of evaluation of constructor arguments is
+        // unspecified, so the fields are read into variables first
+        const std::string game_summary_file = reader.str();
+        const std::string date = reader.str();
+        const std::string name = reader.str();
+        const int xp = (int)reader.u32();
+        const int lvl = (int)reader.u32();
+        const int dlvl = (int)reader.u32();
+        const int turn_count = (int)reader.u32();
+        const int ins = (int)reader.u32();
+        const IsWin is_win = (IsWin)reader.u32();
+        const Bg bg = (Bg)reader.u32();
+
+        is_ok = reader.is_ok;
+
+        return HighscoreEntry(
+                game_summary_file,
+                date,
+                name,
+                xp,
+                lvl,
+                dlvl,
+                turn_count,
+                ins,
+                is_win,
+                bg);
+}
 
-        file.open("res/data/highscores", std::ios::trunc);
+uint32_t file_size(const std::string& path)
+{
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
 
-        for (const auto entry : entries)
+        if (!file.is_open())
         {
-                const std::string win_str =
-                        (entry.is_win() == IsWin::yes) ?
-                        "1" :
-                        "0";
+                return 0;
+        }
+
+        return (uint32_t)file.tellg();
+}
+
+// Reads the record starting at the current file position - a record size
+// going past the end of the file (i.e. a corrupt log) is rejected
+bool read_record(std::istream& file,
+                 const uint32_t log_size,
+                 std::string& record)
+{
+        const std::streamoff pos = file.tellg();
+
+        if ((pos < 0) || ((pos + 4) > (std::streamoff)log_size))
+        {
+                return false;
+        }
+
+        char size_buffer[4];
+
+        if (!file.read(size_buffer, 4))
+        {
+                return false;
+        }
+
+        const uint32_t record_size = get_u32(size_buffer);
+
+        if (record_size > (log_size - pos - 4))
+        {
+                return false;
+        }
+
+        record.resize(record_size);
+
+        return (bool)file.read(&record[0], record.size());
+}
+
+// Cuts off anything after the given size, by rewriting the log
+void truncate_log(const uint32_t size)
+{
+        std::string buffer(size, 0);
+
+        {
+                std::ifstream file(log_path, std::ios::in | std::ios::binary);
+
+                if (!file.read(&buffer[0], size))
+                {
+                        return;
+                }
+        }
+
+        std::ofstream file(log_path,
+                           std::ios::out |
+                           std::ios::binary |
+                           std::ios::trunc);
 
-                file << entry.game_summary_file_path() << std::endl;
-                file << win_str << std::endl;
-                file << entry.date() << std::endl;
-                file << entry.name() << std::endl;
-                file << entry.xp() << std::endl;
-                file << entry.lvl() << std::endl;
-                file << entry.dlvl() << std::endl;
-                file << entry.turn_count() << std::endl;
-                file << entry.ins() << std::endl;
-                file << (int)entry.bg() << std::endl;
+        file.write(buffer.data(), buffer.size());
+}
+
+bool cmp_idx_entries(const HighscoreIdxEntry& e1, const HighscoreIdxEntry& e2)
+{
+        return e1.score > e2.score;
+}
+
+void write_index(const Index& index)
+{
+        std::string buffer;
+
+        buffer.reserve(
+                index_header_size +
+                (index.entries.size() * index_entry_size));
+
+        put_u32(buffer, index_magic);
+        put_u32(buffer, format_version);
+        put_u32(buffer, index.log_size);
+        put_u32(buffer, index.entries.size());
+
+        for (const auto& e : index.entries)
+        {
+                put_u32(buffer, (uint32_t)e.score);
+                put_u32(buffer, e.offset);
         }
+
+        std::ofstream file(index_path,
+                           std::ios::out |
+                           std::ios::binary |
+                           std::ios::trunc);
+
+        file.write(buffer.data(), buffer.size());
 }
 
-std::vector<HighscoreEntry> read_file()
+// Scans all records of the log - only done if the index is missing or stale
+Index build_index()
+{
+        TRACE_FUNC_BEGIN;
+
+        Index index;
+
+        index.log_size = 0;
+
+        std::ifstream file(log_path, std::ios::in | std::ios::binary);
+
+        char header[log_header_size];
+
+        if (!file.read(header, log_header_size) ||
+            (get_u32(header) != log_magic) ||
+            (get_u32(header + 4) != format_version))
+        {
+                TRACE_FUNC_END;
+
+                return index;
+        }
+
+        index.log_size = log_header_size;
+
+        const uint32_t size_on_disk = file_size(log_path);
+
+        std::string record;
+
+        while (read_record(file, size_on_disk, record))
+        {
+                bool is_ok = false;
+
+                const auto entry = decode_record(record, is_ok);
+
+                if (!is_ok)
+                {
+                        break;
+                }
+
+                index.entries.push_back({entry.score(), index.log_size});
+
+                index.log_size += 4 + record.size();
+        }
+
+        file.close();
+
+        if (index.log_size < size_on_disk)
+        {
+                // The last record is broken (e.g. the game was killed while
+                // writing it), remove it so that the log size matches the
+                // index again
+                TRACE << "Removing broken record at the end of the "
+                      << "highscore log" << std::endl;
+
+                truncate_log(index.log_size);
+        }
+
+        // Entries with equal score are kept in the order they were added
+        std::stable_sort(
+                std::begin(index.entries),
+                std::end(index.entries),
+                cmp_idx_entries);
+
+        TRACE << "Highscore index built with "
+              << index.entries.size()
+              << " entries"
+              << std::endl;
+
+        write_index(index);
+
+        TRACE_FUNC_END;
+
+        return index;
+}
+
+Index load_index()
+{
+        const uint32_t log_size = file_size(log_path);
+
+        std::ifstream file(index_path, std::ios::in | std::ios::binary);
+
+        char header[index_header_size];
+
+        if (!file.read(header, index_header_size) ||
+            (get_u32(header) != index_magic) ||
+            (get_u32(header + 4) != format_version) ||
+            (get_u32(header + 8) != log_size))
+        {
+                return build_index();
+        }
+
+        const size_t nr_entries = get_u32(header + 12);
+
+        std::string buffer(nr_entries * index_entry_size, 0);
+
+        if (!file.read(&buffer[0], buffer.size()))
+        {
+                return build_index();
+        }
+
+        Index index;
+
+        index.log_size = log_size;
+
+        index.entries.resize(nr_entries);
+
+        for (size_t i = 0; i < nr_entries; ++i)
+        {
+                const char* const src = buffer.data() + (i * index_entry_size);
+
+                index.entries[i].score = (int)get_u32(src);
+
+                index.entries[i].offset = get_u32(src + 4);
+        }
+
+        return index;
+}
+
+// Appends the entry to the log, and inserts it in the index
+void append_to_log(const HighscoreEntry& entry, Index& index)
+{
+        std::fstream file;
+
+        if (index.log_size == 0)
+        {
+                file.open(log_path,
+                          std::ios::out |
+                          std::ios::binary |
+                          std::ios::trunc);
+
+                std::string header;
+
+                put_u32(header, log_magic);
+                put_u32(header, format_version);
+
+                file.write(header.data(), header.size());
+
+                index.log_size = log_header_size;
+        }
+        else
+        {
+                file.open(log_path,
+                          std::ios::out |
+                          std::ios::binary |
+                          std::ios::app);
+        }
+
+        const std::string record = encode_record(entry);
+
+        file.write(record.data(), record.size());
+
+        if (!file.good())
+        {
+                TRACE << "Failed to write highscore entry" << std::endl;
+
+                return;
+        }
+
+        const HighscoreIdxEntry idx_entry = {entry.score(), index.log_size};
+
+        // After any entries with the same score
+        const auto insert_it =
+                std::upper_bound(
+                        std::begin(index.entries),
+                        std::end(index.entries),
+                        idx_entry,
+                        cmp_idx_entries);
+
+        index.entries.insert(insert_it, idx_entry);
+
+        index.log_size += record.size();
+}
+
+std::vector<HighscoreEntry> read_legacy_file()
 {
         TRACE_FUNC_BEGIN;
 
@@ -131,7 +534,7 @@ std::vector<HighscoreEntry> read_file()
 
         std::ifstream file;
 
-        file.open("res/data/highscores");
+        file.open(legacy_path);
 
         if (!file.is_open())
         {
@@ -200,7 +603,28 @@ std::vector<HighscoreEntry> read_file()
 
 void init()
 {
+        // Convert highscores from the old text format (the old file is left
+        // as it is)
+        if (file_size(log_path) > 0)
+        {
+                return;
+        }
+
+        const auto legacy_entries = read_legacy_file();
+
+        if (legacy_entries.empty())
+        {
+                return;
+        }
+
+        Index index = load_index();
 
+        for (const auto& entry : legacy_entries)
+        {
+                append_to_log(entry, index);
+        }
+
+        write_index(index);
 }
 
 void cleanup()
@@ -233,29 +657,69 @@ void append_entry_to_highscores_file(const HighscoreEntry& entry)
 {
         TRACE_FUNC_BEGIN;
 
-        std::vector<HighscoreEntry> entries = entries_sorted();
-
-        entries.push_back(entry);
+        Index index = load_index();
 
-        sort_entries(entries);
+        append_to_log(entry, index);
 
-        write_file(entries);
+        write_index(index);
 
         TRACE_FUNC_END;
 }
 
-std::vector<HighscoreEntry> entries_sorted()
+std::vector<HighscoreIdxEntry> read_index()
+{
+        return load_index().entries;
+}
+
+std::vector<HighscoreEntry> read_entries(
+        const std::vector<HighscoreIdxEntry>& index,
+        const Range& idx_range)
 {
-        auto entries = read_file();
+        std::vector<HighscoreEntry> entries;
+
+        const uint32_t log_size = file_size(log_path);
+
+        std::ifstream file(log_path, std::ios::in | std::ios::binary);
 
-        if (!entries.empty())
+        std::string record;
+
+        for (int i = idx_range.min; i <= idx_range.max; ++i)
         {
-                sort_entries(entries);
+                file.seekg(index[i].offset);
+
+                bool is_ok = read_record(file, log_size, record);
+
+                if (is_ok)
+                {
+                        entries.push_back(decode_record(record, is_ok));
+                }
+
+                if (!is_ok)
+                {
+                        // The log has been changed since the index was read
+                        TRACE << "Failed to read highscore entry" << std::endl;
+
+                        entries.clear();
+
+                        break;
+                }
         }
 
         return entries;
 }
 
+std::vector<HighscoreEntry> entries_sorted()
+{
+        const auto index = read_index();
+
+        if (index.empty())
+        {
+                return {};
+        }
+
+        return read_entries(index, Range(0, index.size() - 1));
+}
+
 } // highscore
 
 // -----------------------------------------------------------------------------
@@ -287,16 +751,32 @@ StateId BrowseHighscore::id()
 
 void BrowseHighscore::on_start()
 {
-        entries_ = highscore::read_file();
+        index_ = highscore::read_index();
 
-        highscore::sort_entries(entries_);
+        browser_.reset(index_.size(), get_max_nr_entries_on_screen());
 
-        browser_.reset(entries_.size(), get_max_nr_entries_on_screen());
+        read_page();
+}
+
+void BrowseHighscore::read_page()
+{
+        const Range idx_range = browser_.range_shown();
+
+        if (!page_.empty() &&
+            (idx_range.min == page_idx_range_.min) &&
+            (idx_range.max == page_idx_range_.max))
+        {
+                return;
+        }
+
+        page_ = highscore::read_entries(index_, idx_range);
+
+        page_idx_range_ = idx_range;
 }
 
 void BrowseHighscore::draw()
 {
-        if (entries_.empty())
+        if (page_.empty())
         {
                 return;
         }
@@ -350,11 +830,9 @@ void BrowseHighscore::draw()
 
         int y = entries_y0_;
 
-        const Range idx_range_shown = browser_.range_shown();
-
-        for (int i = idx_range_shown.min; i <= idx_range_shown.max; ++i)
+        for (int i = page_idx_range_.min; i <= page_idx_range_.max; ++i)
         {
-                const auto& entry = entries_[i];
+                const auto& entry = page_[i - page_idx_range_.min];
 
                 const std::string date = entry.date();
                 const std::string name = entry.name();
@@ -409,7 +887,7 @@ void BrowseHighscore::draw()
 
 void BrowseHighscore::update()
 {
-        if (entries_.empty())
+        if (index_.empty())
         {
                 popup::show_msg("No high score entries found.");
 
@@ -427,16 +905,26 @@ void BrowseHighscore::update()
                 browser_.read(input,
                               MenuInputMode::scrolling);
 
+        read_page();
+
         switch (action)
         {
         case MenuAction::selected:
         case MenuAction::selected_shift:
         {
+                if (page_.empty())
+                {
+                        // The entries could not be read
+                        break;
+                }
+
                 const int browser_y = browser_.y();
 
-                ASSERT(browser_y < (int)entries_.size());
+                ASSERT(browser_y >= page_idx_range_.min);
+                ASSERT(browser_y <= page_idx_range_.max);
 
-                const auto& entry_marked = entries_[browser_y];
+                const auto& entry_marked =
+                        page_[browser_y - page_idx_range_.min];
 
                 const std::string file_path =
                         entry_marked.game_summary_file_path();
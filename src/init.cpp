@@ -85,8 +85,6 @@ void init_session()
     TRACE_FUNC_BEGIN;
 
     actor_data::init();
-    feature_data::init();
-    property_data::init();
     item_data::init();
     scroll_handling::init();
     potion_handling::init();
@@ -19,6 +19,8 @@
 #include "config.hpp"
 #include "colors.hpp"
 #include "rl_utils.hpp"
+#include "perf_stats.hpp"
+#include "replay.hpp"
 
 // -----------------------------------------------------------------------------
 // Private
@@ -32,6 +34,17 @@ static int bpp_ = -1;
 static SDL_Surface* screen_srf_ = nullptr;
 static SDL_Texture* screen_texture_ = nullptr;
 
+// Off-screen surface keeping the drawn map cells between frames
+static SDL_Surface* map_layer_srf_ = nullptr;
+
+// Is the content of the map layer kept from the previous frame? (false if the
+// layer was just created, and nothing has been drawn on it yet)
+static bool is_map_layer_retained_ = false;
+
+// The surface which drawing functions currently write to (either the screen
+// surface or the map layer)
+static SDL_Surface* draw_srf_ = nullptr;
+
 static SDL_Surface* main_menu_logo_srf_ = nullptr;
 static SDL_Surface* skull_srf_ = nullptr;
 
@@ -48,6 +61,23 @@ static const SDL_Color sdl_color_black = {0, 0, 0, 0};
 
 static SDL_Event sdl_event_;
 
+// Has anything been drawn since the screen was last presented? (presenting an
+// unchanged screen again is skipped)
+static bool is_screen_changed_ = true;
+
+// Set when a key repeat is dropped, to also drop the text input event which
+// follows it
+static bool is_skipping_repeated_text_ = false;
+
+// Key repeats which have waited longer than this in the event queue are
+// dropped, so that holding down a key does not build up a backlog of commands
+// which continue to run after the key is released (other queued input is kept)
+static const Uint32 max_key_repeat_lag_ms_ = 50;
+
+// Longest time to wait for an event before checking again (the input loop
+// sleeps until an event arrives, so this is only a safety net)
+static const int input_wait_timeout_ms_ = 1000;
+
 // Pointer to function used for writing pixels on the screen (there are
 // different variants depending on bpp)
 static void (*put_px_ptr_)(
@@ -180,7 +210,9 @@ static void blit_surface(SDL_Surface& srf, const PxPos pos)
         dst_rect.w = srf.w;
         dst_rect.h = srf.h;
 
-        SDL_BlitSurface(&srf, nullptr, screen_srf_, &dst_rect);
+        SDL_BlitSurface(&srf, nullptr, draw_srf_, &dst_rect);
+
+        is_screen_changed_ = true;
 }
 
 static  void load_contour(const std::vector<P>& source_px_data,
@@ -401,12 +433,12 @@ static void load_tiles()
 static void put_pixels_on_screen(
         const std::vector<P> px_data,
         const PxPos pos,
-        const Color& color)
+        const Color color)
 {
         const auto sdl_color = color.sdl_color();
 
         const int px_color = SDL_MapRGB(
-                screen_srf_->format,
+                draw_srf_->format,
                 sdl_color.r,
                 sdl_color.g,
                 sdl_color.b);
@@ -416,17 +448,19 @@ static void put_pixels_on_screen(
                 const int screen_px_x = pos.value.x + p_relative.x;
                 const int screen_px_y = pos.value.y + p_relative.y;
 
-                put_px_ptr_(*screen_srf_,
+                put_px_ptr_(*draw_srf_,
                             screen_px_x,
                             screen_px_y,
                             px_color);
         }
+
+        is_screen_changed_ = true;
 }
 
 static void put_pixels_on_screen(
         const TileId tile,
         const PxPos pos,
-        const Color& color)
+        const Color color)
 {
         const auto& pixel_data = tile_px_data_[(size_t)tile];
 
@@ -436,7 +470,7 @@ static void put_pixels_on_screen(
 static void put_pixels_on_screen(
         const char character,
         const PxPos pos,
-        const Color& color)
+        const Color color)
 {
         const P sheet_pos(gfx::character_pos(character));
 
@@ -448,8 +482,8 @@ static void put_pixels_on_screen(
 static void draw_character(
         const char character,
         const PxPos pos,
-        const Color& color,
-        const Color& bg_color = Color(0, 0, 0))
+        const Color color,
+        const Color bg_color = Color(0, 0, 0))
 {
         const PxPos cell_dims(
                 config::map_cell_px_w(),
@@ -581,6 +615,31 @@ void init()
                 PANIC;
         }
 
+        map_layer_srf_ = SDL_CreateRGBSurface(
+                0,
+                screen_px_w,
+                screen_px_h,
+                screen_bpp,
+                0x00FF0000,
+                0x0000FF00,
+                0x000000FF,
+                0xFF000000);
+
+        if (!map_layer_srf_)
+        {
+                TRACE_ERROR_RELEASE << "Failed to create map layer surface"
+                                    << std::endl;
+
+                PANIC;
+        }
+
+        // The map layer is copied as-is onto the screen, no alpha blending
+        SDL_SetSurfaceBlendMode(map_layer_srf_, SDL_BLENDMODE_NONE);
+
+        is_map_layer_retained_ = false;
+
+        draw_srf_ = screen_srf_;
+
         bpp_ = screen_srf_->format->BytesPerPixel;
 
         switch (bpp_)
@@ -633,6 +692,11 @@ void init()
                 load_images();
         }
 
+        // Text input is enabled for the whole session (not only while waiting
+        // for input) - stopping it discards queued text events, so letters
+        // typed ahead while the game is busy would be lost
+        SDL_StartTextInput();
+
         TRACE_FUNC_END;
 }
 
@@ -648,6 +712,8 @@ void cleanup()
 
         if (sdl_window_)
         {
+                SDL_StopTextInput();
+
                 SDL_DestroyWindow(sdl_window_);
                 sdl_window_ = nullptr;
         }
@@ -664,6 +730,16 @@ void cleanup()
                 screen_srf_ = nullptr;
         }
 
+        if (map_layer_srf_)
+        {
+                SDL_FreeSurface(map_layer_srf_);
+                map_layer_srf_ = nullptr;
+        }
+
+        draw_srf_ = nullptr;
+
+        is_map_layer_retained_ = false;
+
         if (main_menu_logo_srf_)
         {
                 SDL_FreeSurface(main_menu_logo_srf_);
@@ -679,10 +755,26 @@ void cleanup()
         TRACE_FUNC_END;
 }
 
-void update_screen()
+void update_screen(const AllowFrameSkip allow_frame_skip)
 {
-        if (is_inited())
+        perf_stats::Measure perf_measure(PerfCounter::update_screen);
+
+        // Replays are played back without presenting anything
+        if (replay::is_playing())
+        {
+                return;
+        }
+
+        if ((allow_frame_skip == AllowFrameSkip::yes) &&
+            sdl_base::is_fast_forward())
+        {
+                return;
+        }
+
+        if (is_inited() && is_screen_changed_)
         {
+                is_screen_changed_ = false;
+
                 SDL_UpdateTexture(
                         screen_texture_,
                         nullptr,
@@ -707,9 +799,55 @@ void clear_screen()
                         screen_srf_,
                         nullptr,
                         SDL_MapRGB(screen_srf_->format, 0, 0, 0));
+
+                is_screen_changed_ = true;
         }
 }
 
+bool begin_map_layer()
+{
+        if (!is_inited())
+        {
+                return false;
+        }
+
+        draw_srf_ = map_layer_srf_;
+
+        const bool was_retained = is_map_layer_retained_;
+
+        is_map_layer_retained_ = true;
+
+        return was_retained;
+}
+
+void end_map_layer()
+{
+        draw_srf_ = screen_srf_;
+}
+
+void blit_map_layer()
+{
+        if (!is_inited())
+        {
+                return;
+        }
+
+        const PxRect px_area = to_px_rect(panels::get_area(Panel::map));
+
+        SDL_Rect sdl_rect = {
+                (Sint16)px_area.value.p0.x,
+                (Sint16)px_area.value.p0.y,
+                (Uint16)px_area.value.w(),
+                (Uint16)px_area.value.h()
+        };
+
+        SDL_Rect dst_rect = sdl_rect;
+
+        SDL_BlitSurface(map_layer_srf_, &sdl_rect, screen_srf_, &dst_rect);
+
+        is_screen_changed_ = true;
+}
+
 int to_px_x(const int value)
 {
         return value * config::map_cell_px_w();
@@ -746,8 +884,8 @@ void draw_tile(
         const TileId tile,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& bg_color)
+        const Color color,
+        const Color bg_color)
 {
         if (!is_inited())
         {
@@ -785,8 +923,8 @@ void draw_character(
         const char character,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& bg_color)
+        const Color color,
+        const Color bg_color)
 {
         if (!is_inited())
         {
@@ -810,8 +948,8 @@ void draw_text(
         const std::string& str,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& bg_color)
+        const Color color,
+        const Color bg_color)
 {
         if (!is_inited())
         {
@@ -879,8 +1017,8 @@ int draw_text_center(
         const std::string& str,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& bg_color,
+        const Color color,
+        const Color bg_color,
         const bool is_pixel_pos_adj_allowed)
 {
         if (!is_inited())
@@ -924,13 +1062,15 @@ int draw_text_center(
         };
 
         SDL_FillRect(
-                screen_srf_,
+                draw_srf_,
                 &sdl_rect,
-                SDL_MapRGB(screen_srf_->format,
+                SDL_MapRGB(draw_srf_->format,
                            sdl_bg_color.r,
                            sdl_bg_color.g,
                            sdl_bg_color.b));
 
+        is_screen_changed_ = true;
+
         for (int i = 0; i < len; ++i)
         {
                 if ((px_pos.value.x) < 0 ||
@@ -954,7 +1094,7 @@ int draw_text_center(
 void draw_rectangle_solid(
         const PxPos pos,
         const PxPos dims,
-        const Color& color)
+        const Color color)
 {
         if (is_inited())
         {
@@ -967,12 +1107,14 @@ void draw_rectangle_solid(
 
                 const SDL_Color& sdl_color = color.sdl_color();
 
-                SDL_FillRect(screen_srf_,
+                SDL_FillRect(draw_srf_,
                              &sdl_rect,
-                             SDL_MapRGB(screen_srf_->format,
+                             SDL_MapRGB(draw_srf_->format,
                                         sdl_color.r,
                                         sdl_color.g,
                                         sdl_color.b));
+
+                is_screen_changed_ = true;
         }
 }
 
@@ -1009,14 +1151,14 @@ void cover_cell(const Panel panel, const P offset)
         cover_area(panel, offset, P(1, 1));
 }
 
-void draw_line_hor(const PxPos px_pos, const int px_w, const Color& color)
+void draw_line_hor(const PxPos px_pos, const int px_w, const Color color)
 {
         const PxPos px_dims(px_w, 2);
 
         draw_rectangle_solid(px_pos, px_dims, color);
 }
 
-void draw_line_ver(const PxPos px_pos, const int px_h, const Color& color)
+void draw_line_ver(const PxPos px_pos, const int px_h, const Color color)
 {
         const PxPos px_dims(1, px_h);
 
@@ -1026,7 +1168,7 @@ void draw_line_ver(const PxPos px_pos, const int px_h, const Color& color)
 void draw_box(
         const R& border,
         const Panel panel,
-        const Color& color,
+        const Color color,
         const bool do_cover_area)
 {
         if (do_cover_area)
@@ -1122,8 +1264,8 @@ void draw_descr_box(const std::vector<ColoredString>& lines)
 
         for (const auto& line : lines)
         {
-                const auto formatted =
-                        text_format::split(
+                const auto& formatted =
+                        text_format::split_cached(
                                 line.str,
                                 panels::get_w(Panel::item_descr));
 
@@ -1176,8 +1318,8 @@ void draw_blast_at_field(
         const P center_pos,
         const int radius,
         bool forbidden_cells[map_w][map_h],
-        const Color& color_inner,
-        const Color& color_outer)
+        const Color color_inner,
+        const Color color_outer)
 {
         TRACE_FUNC_BEGIN;
 
@@ -1275,7 +1417,7 @@ void draw_blast_at_field(
         TRACE_FUNC_END;
 }
 
-void draw_blast_at_cells(const std::vector<P>& positions, const Color& color)
+void draw_blast_at_cells(const std::vector<P>& positions, const Color color)
 {
         TRACE_FUNC_BEGIN;
 
@@ -1320,7 +1462,7 @@ void draw_blast_at_cells(const std::vector<P>& positions, const Color& color)
 }
 
 void draw_blast_at_seen_cells(const std::vector<P>& positions,
-                              const Color& color)
+                              const Color color)
 {
         if (is_inited())
         {
@@ -1342,7 +1484,7 @@ void draw_blast_at_seen_cells(const std::vector<P>& positions,
 }
 
 void draw_blast_at_seen_actors(const std::vector<Actor*>& actors,
-                               const Color& color)
+                               const Color color)
 {
         if (is_inited())
         {
@@ -1362,8 +1504,8 @@ void draw_symbol(
         const char character,
         const Panel panel,
         const P pos,
-        const Color& color,
-        const Color& color_bg)
+        const Color color,
+        const Color color_bg)
 {
         if (config::is_tiles_mode())
         {
@@ -1407,17 +1549,44 @@ InputData get(const bool is_o_return)
                 return ret;
         }
 
-        SDL_StartTextInput();
+        {
+                const bool was_replay_playing = replay::is_playing();
+
+                if (replay::try_get_input(ret))
+                {
+                        return ret;
+                }
+
+                if (replay::is_quit_requested())
+                {
+                        // Cancel whatever is waiting for input, until the
+                        // main loop is reached (which then exits)
+                        return InputData(SDLK_ESCAPE);
+                }
+
+                if (was_replay_playing)
+                {
+                        // Playback just ended, show where it ended
+                        io::update_screen(AllowFrameSkip::no);
+                }
+        }
 
         bool is_done = false;
 
-        while (!is_done)
+        // Show any frames skipped while fast-forwarding before waiting
+        if (sdl_base::is_fast_forward())
         {
-                sdl_base::sleep(1);
+                io::update_screen(AllowFrameSkip::no);
+        }
 
-                const bool did_poll_event = SDL_PollEvent(&sdl_event_);
+        while (!is_done)
+        {
+                // Sleep until there is an event (instead of polling)
+                const bool did_get_event =
+                        SDL_WaitEventTimeout(&sdl_event_,
+                                             input_wait_timeout_ms_);
 
-                if (!did_poll_event)
+                if (!did_get_event)
                 {
                         continue;
                 }
@@ -1432,7 +1601,9 @@ InputData get(const bool is_o_return)
                         case SDL_WINDOWEVENT_FOCUS_GAINED:
                         case SDL_WINDOWEVENT_RESTORED:
                         {
-                                io::update_screen();
+                                is_screen_changed_ = true;
+
+                                io::update_screen(AllowFrameSkip::no);
 
                                 clear_events();
 
@@ -1440,6 +1611,15 @@ InputData get(const bool is_o_return)
                         }
                         break;
 
+                        case SDL_WINDOWEVENT_EXPOSED:
+                        {
+                                // The window content must be drawn again
+                                is_screen_changed_ = true;
+
+                                io::update_screen(AllowFrameSkip::no);
+                        }
+                        break;
+
                         default:
                                 break;
                         }
@@ -1458,6 +1638,19 @@ InputData get(const bool is_o_return)
                 {
                         const int key = sdl_event_.key.keysym.sym;
 
+                        // Drop key repeats if we are falling behind
+                        const Uint32 lag_ms =
+                                SDL_GetTicks() - sdl_event_.key.timestamp;
+
+                        is_skipping_repeated_text_ =
+                                sdl_event_.key.repeat &&
+                                (lag_ms > max_key_repeat_lag_ms_);
+
+                        if (is_skipping_repeated_text_)
+                        {
+                                continue;
+                        }
+
                         // Do not return shift/control/alt as separate events
                         if (key == SDLK_LSHIFT ||
                             key == SDLK_RSHIFT ||
@@ -1480,7 +1673,7 @@ InputData get(const bool is_o_return)
                                 is_shift_held,
                                 is_ctrl_held);
 
-                        if (key >= SDLK_F1 && key <= SDLK_F9)
+                        if (key >= SDLK_F1 && key <= SDLK_F12)
                         {
                                 // F keys
                                 is_done = true;
@@ -1535,6 +1728,13 @@ InputData get(const bool is_o_return)
 
                 case SDL_TEXTINPUT:
                 {
+                        if (is_skipping_repeated_text_)
+                        {
+                                is_skipping_repeated_text_ = false;
+
+                                continue;
+                        }
+
                         const char c = sdl_event_.text.text[0];
 
                         if ((c == 'o' || c == 'O') &&
@@ -1553,8 +1753,8 @@ InputData get(const bool is_o_return)
                                 // ASCII char entered
                                 // (Decimal unicode '!' = 33, '~' = 126)
 
-                                clear_events();
-
+                                // NOTE: Remaining events are kept, so that
+                                // keys typed ahead are not lost
                                 ret = InputData((int)c);
 
                                 is_done = true;
@@ -1572,7 +1772,7 @@ InputData get(const bool is_o_return)
                 } // Event type switch
         } // While
 
-        SDL_StopTextInput();
+        replay::on_input(ret);
 
         return ret;
 }
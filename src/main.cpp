@@ -5,6 +5,9 @@
 #include "io.hpp"
 #include "init.hpp"
 #include "main_menu.hpp"
+#include "colors.hpp"
+#include "actor_data.hpp"
+#include "replay.hpp"
 
 #ifdef _WIN32
 #undef main
@@ -13,22 +16,90 @@ int main(int argc, char** argv)
 {
     TRACE_FUNC_BEGIN;
 
-#ifdef NDEBUG
-    (void)argc;
-    (void)argv;
-#else // NDEBUG
+    bool is_validate_data = false;
+
+    std::string record_path = "";
+    std::string replay_path = "";
+
+    ReplayEnd replay_end = ReplayEnd::continue_live;
+
     for (int arg_nr = 0; arg_nr < argc; ++arg_nr)
     {
         const std::string arg_str = std::string(argv[arg_nr]);
 
+        const bool has_value = (arg_nr + 1) < argc;
+
+        if (arg_str == "--validate-data")
+        {
+            is_validate_data = true;
+        }
+        else if ((arg_str == "--record") && has_value)
+        {
+            record_path = argv[++arg_nr];
+        }
+        else if ((arg_str == "--replay") && has_value)
+        {
+            replay_path = argv[++arg_nr];
+        }
+        else if ((arg_str == "--benchmark") && has_value)
+        {
+            // Replay at full speed, then exit
+            replay_path = argv[++arg_nr];
+
+            replay_end = ReplayEnd::quit;
+        }
+
+#ifndef NDEBUG
         if (arg_str == "--demo-mapgen")
         {
             init::is_demo_mapgen = true;
         }
-    }
 #endif // NDEBUG
+    }
 
-    rnd::seed();
+    // Check the data files and regenerate the binary data built from them,
+    // without starting the game (no window or audio is needed for this)
+    if (is_validate_data)
+    {
+        colors::init();
+
+        const bool is_ok = actor_data::validate_data();
+
+        return is_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if (!record_path.empty() && !replay_path.empty())
+    {
+        TRACE_ERROR_RELEASE << "Cannot record while playing back a replay "
+                            << "(--record cannot be combined with --replay "
+                            << "or --benchmark)"
+                            << std::endl;
+
+        return EXIT_FAILURE;
+    }
+
+    if (replay_path.empty())
+    {
+        const uint32_t seed = rnd::seed();
+
+        if (!record_path.empty() &&
+            !replay::start_recording(record_path, seed))
+        {
+            TRACE_ERROR_RELEASE << "Failed to open replay file for writing: "
+                                << record_path
+                                << std::endl;
+
+            return EXIT_FAILURE;
+        }
+    }
+    else if (!replay::start_playing(replay_path, replay_end))
+    {
+        TRACE_ERROR_RELEASE << "Failed to read replay file: "
+                            << replay_path
+                            << std::endl;
+
+        return EXIT_FAILURE;
+    }
 
     init::init_io();
     init::init_game();
@@ -47,18 +118,40 @@ int main(int argc, char** argv)
             break;
         }
 
+        PROFILE_SCOPE("frame");
+
         io::clear_screen();
 
         states::draw();
 
-        io::update_screen();
+        // Once per state cycle, even while fast-forwarding - so the game is
+        // shown once per player turn
+        io::update_screen(AllowFrameSkip::no);
 
         states::update();
+
+        if (replay::is_quit_requested())
+        {
+            states::pop_all();
+        }
     }
 
     init::cleanup_session();
     init::cleanup_game();
     init::cleanup_io();
 
+    replay::cleanup();
+
+#ifdef IA_PROFILE
+    const std::string profile_path = "ia_profile.json";
+
+    if (!profile::dump_chrome_trace(profile_path))
+    {
+        TRACE_ERROR_RELEASE << "Failed to write profiling data to: "
+                            << profile_path
+                            << std::endl;
+    }
+#endif // IA_PROFILE
+
     return 0;
 }
@@ -251,6 +251,8 @@ void MainMenuState::draw()
                 const int logo_x_pos_left =
                         (map_w - text_mode_logo_[0].size()) / 2;
 
+                rnd::StreamScope rnd_stream(rnd::Stream::cosmetic);
+
                 for (const std::string& row : text_mode_logo_)
                 {
                         pos.x = logo_x_pos_left;
@@ -501,7 +503,11 @@ void MainMenuState::update()
 
 void MainMenuState::on_start()
 {
-        current_quote_ = rnd::element(quotes_);
+        {
+                rnd::StreamScope rnd_stream(rnd::Stream::cosmetic);
+
+                current_quote_ = rnd::element(quotes_);
+        }
 
         audio::play_music(MusId::cthulhiana_madness);
 }
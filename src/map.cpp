@@ -15,6 +15,7 @@
 #include "feature_rigid.hpp"
 #include "saving.hpp"
 #include "actor_player.hpp"
+#include "sound.hpp"
 
 #ifndef NDEBUG
 #include "sdl_base.hpp"
@@ -77,8 +78,14 @@ std::vector<ChokePointData> choke_point_data;
 namespace
 {
 
+int terrain_revision_ = 0;
+
+bool is_vision_stale_ = false;
+
 void reset_cells(const bool make_stone_walls)
 {
+    ++terrain_revision_;
+
     for (int x = 0; x < map_w; ++x)
     {
         for (int y = 0; y < map_h; ++y)
@@ -161,11 +168,15 @@ void reset()
 
     choke_point_data.clear();
 
+    snd_emit::clear_pending_snds();
+
     reset_cells(true);
 
     game_time::erase_all_mobs();
     game_time::reset_turn_type_and_actor_counters();
 
+    is_vision_stale_ = false;
+
     // Occasionally set wall color to something unusual
     if (rnd::one_in(3))
     {
@@ -198,6 +209,13 @@ Rigid* put(Rigid* const f)
 
     cell.rigid = f;
 
+    ++terrain_revision_;
+
+    if (mapgen::active_connectivity)
+    {
+        mapgen::active_connectivity->on_rigid_put(p);
+    }
+
 #ifndef NDEBUG
     if (init::is_demo_mapgen)
     {
@@ -225,8 +243,19 @@ Rigid* put(Rigid* const f)
     return f;
 }
 
+int terrain_revision()
+{
+    return terrain_revision_;
+}
+
 void update_vision()
 {
+    PROFILE_SCOPE(__func__);
+
+    // NOTE: Cleared first, since the update below reads the vision data (which
+    // would otherwise trigger another update)
+    is_vision_stale_ = false;
+
     game_time::update_light_map();
 
     map::player->update_fov();
@@ -236,6 +265,19 @@ void update_vision()
     states::draw();
 }
 
+void request_vision_update()
+{
+    is_vision_stale_ = true;
+}
+
+void update_vision_if_stale()
+{
+    if (is_vision_stale_)
+    {
+        update_vision();
+    }
+}
+
 void make_blood(const P& origin)
 {
     for (int dx = -1; dx <= 1; ++dx)
@@ -292,6 +334,8 @@ bool is_pos_seen_by_player(const P& p)
 {
     ASSERT(map::is_pos_inside_map(p));
 
+    update_vision_if_stale();
+
     return cells[p.x][p.y].is_seen_by_player;
 }
 
@@ -21,11 +21,14 @@ void MapBuilder::build()
 {
         TRACE_FUNC_BEGIN;
 
+        rnd::StreamScope rnd_stream(rnd::Stream::mapgen);
+
         bool map_ok = false;
 
 #ifndef NDEBUG
         int nr_attempts = 0;
         auto start_time = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::duration discarded_duration(0);
 #endif // NDEBUG
 
         // TODO: When the map is invalid, any unique items spawned are lost
@@ -40,6 +43,11 @@ void MapBuilder::build()
 
                 map::reset();
 
+#ifndef NDEBUG
+                const auto attempt_start_time =
+                        std::chrono::steady_clock::now();
+#endif // NDEBUG
+
                 map_ok = build_specific();
 
                 if (map_ok)
@@ -49,6 +57,12 @@ void MapBuilder::build()
                 else
                 {
                         map_templates::on_map_discarded();
+
+#ifndef NDEBUG
+                        discarded_duration +=
+                                std::chrono::steady_clock::now() -
+                                attempt_start_time;
+#endif // NDEBUG
                 }
         }
 
@@ -86,6 +100,11 @@ void MapBuilder::build()
         TRACE << "Map built after " << nr_attempts << " attempt(s)."
               << std::endl
               << "Total time taken: " <<  duration << " ms"
+              << std::endl
+              << "Time spent on discarded attempts: "
+              << std::chrono::duration<double, std::milli>(
+                      discarded_duration).count()
+              << " ms"
               << std::endl;
 #endif // NDEBUG
 
@@ -333,6 +333,22 @@ bool MapBuilderStd::build_specific()
                 return false;
         }
 
+        // ---------------------------------------------------------------------
+        // Early rejection - everything below this point (decoration, choke
+        // point analysis, population) is comparatively expensive, so verify
+        // with a single flood fill that the map is still connected after the
+        // post-connect hooks and door placement
+        // ---------------------------------------------------------------------
+        if (!mapgen::is_all_rooms_connected())
+        {
+                TRACE << "Map not connected before decoration, "
+                      << "discarding map" << std:: endl;
+
+                mapgen::is_map_valid = false;
+
+                return false;
+        }
+
         // ---------------------------------------------------------------------
         // Decorate the map
         // ---------------------------------------------------------------------
@@ -381,71 +397,29 @@ bool MapBuilderStd::build_specific()
                 }
         }
 
-        for (int x = 0; x < map_w; ++x)
-        {
-                for (int y = 0; y < map_h; ++y)
-                {
-                        if (blocked[x][y] || !mapgen::door_proposals[x][y])
-                        {
-                                continue;
-                        }
+        mapgen::find_choke_points(blocked,
+                                  mapgen::door_proposals,
+                                  map::choke_point_data);
 
-                        ChokePointData d;
-
-                        const bool is_choke =
-                                mapgen::is_choke_point(
-                                        P(x, y),
-                                        blocked,
-                                        &d);
-
-                        // 'is_choke_point' called above may invalidate the map
-                        if (!mapgen::is_map_valid)
-                        {
-                                return false;
-                        }
-
-                        if (!is_choke)
-                        {
-                                continue;
-                        }
-
-                        // Find player and stair side
-                        for (size_t side_idx = 0; side_idx < 2; ++side_idx)
-                        {
-                                for (const P& p : d.sides[side_idx])
-                                {
-                                        if (p == map::player->pos)
-                                        {
-                                                ASSERT(d.player_side == -1);
-
-                                                d.player_side = side_idx;
-                                        }
-
-                                        if (p == stairs_pos)
-                                        {
-                                                ASSERT(d.stairs_side == -1);
-
-                                                d.stairs_side = side_idx;
-                                        }
-                                }
-                        }
-
-                        ASSERT(d.player_side == 0 || d.player_side == 1);
-                        ASSERT(d.stairs_side == 0 || d.stairs_side == 1);
+        // Find player and stair side
+        for (auto& d : map::choke_point_data)
+        {
+                d.player_side = d.side_of(map::player->pos);
+                d.stairs_side = d.side_of(stairs_pos);
 
-                        // Robustness for release mode
-                        if ((d.player_side != 0 && d.player_side != 1) ||
-                            (d.player_side != 0 && d.player_side != 1))
-                        {
-                                // Invalidate the map
-                                mapgen::is_map_valid = false;
+                ASSERT(d.player_side == 0 || d.player_side == 1);
+                ASSERT(d.stairs_side == 0 || d.stairs_side == 1);
 
-                                return false;
-                        }
+                // Robustness for release mode
+                if ((d.player_side != 0 && d.player_side != 1) ||
+                    (d.stairs_side != 0 && d.stairs_side != 1))
+                {
+                        // Invalidate the map
+                        mapgen::is_map_valid = false;
 
-                        map::choke_point_data.emplace_back(d);
-                } // y loop
-        } // x loop
+                        return false;
+                }
+        }
 
         TRACE << "Found " << map::choke_point_data.size()
               << " choke points" << std::endl;
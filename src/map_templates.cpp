@@ -4,6 +4,7 @@
 #include "saving.hpp"
 
 #include <fstream>
+#include <memory>
 #include <unordered_map>
 
 namespace map_templates
@@ -14,7 +15,32 @@ namespace
 
 Array2<char> level_templates_[(size_t)LevelTemplId::END];
 
-std::vector<RoomTempl> room_templates_;
+// Each room template in the data file is placed with all combinations of
+// rotating and flipping - this is the number of variants per template
+const size_t nr_room_templ_variants = 8;
+
+// Variants are described by a combination of these flags
+const size_t variant_flip_hor = 1;
+const size_t variant_flip_ver = 2;
+const size_t variant_transpose = 4;
+
+// Templates as read from the data file (i.e. "base" templates)
+std::vector<RoomTempl> base_room_templates_;
+
+// Reference to a template variant, with the dimensions of the variant - the
+// variant symbols are only created when the variant is picked
+struct RoomTemplVariantRef
+{
+    P dims;
+    size_t base_templ_idx;
+    size_t variant;
+};
+
+// All variants, sorted by width, then height
+std::vector<RoomTemplVariantRef> room_templ_variants_by_dims_;
+
+// Created variants, indexed by base template index and variant
+std::vector< std::unique_ptr<RoomTempl> > room_templ_variants_;
 
 std::vector<RoomTemplStatus> room_templ_status_;
 
@@ -194,63 +220,115 @@ void load_level_templates()
 } // load_level_templates
 
 
-//
-// Add all combinations of rotating and flipping the template
-//
-void make_room_templ_variants(RoomTempl& templ)
+P room_templ_variant_dims(const P& base_dims, const size_t variant)
+{
+    return
+        (variant & variant_transpose) ?
+        P(base_dims.y, base_dims.x) :
+        base_dims;
+}
+
+void make_room_templ_variant(const RoomTempl& base_templ,
+                             const size_t variant,
+                             RoomTempl& out)
 {
-    auto& symbols = templ.symbols;
+    const auto& base_symbols = base_templ.symbols;
 
-    //
-    // "Up"
-    //
-    room_templates_.push_back(templ);
+    const P base_dims(base_symbols.dims());
 
-    symbols.flip_hor();
+    const P dims(room_templ_variant_dims(base_dims, variant));
 
-    room_templates_.push_back(templ);
+    out.symbols.resize(dims);
+    out.type = base_templ.type;
+    out.base_templ_idx = base_templ.base_templ_idx;
 
-    //
-    // "Right"
-    //
-    symbols.rotate_cw();
+    const bool is_transposed = variant & variant_transpose;
+    const bool is_flipped_hor = variant & variant_flip_hor;
+    const bool is_flipped_ver = variant & variant_flip_ver;
 
-    room_templates_.push_back(templ);
+    for (int x = 0; x < dims.x; ++x)
+    {
+        for (int y = 0; y < dims.y; ++y)
+        {
+            P p = is_transposed ? P(y, x) : P(x, y);
+
+            if (is_flipped_hor)
+            {
+                p.x = base_dims.x - 1 - p.x;
+            }
 
-    symbols.flip_ver();
+            if (is_flipped_ver)
+            {
+                p.y = base_dims.y - 1 - p.y;
+            }
+
+            out.symbols(x, y) = base_symbols(p);
+        }
+    }
+}
 
-    room_templates_.push_back(templ);
+RoomTempl& room_templ_variant(const RoomTemplVariantRef& ref)
+{
+    auto& variant_ptr =
+        room_templ_variants_[
+            (ref.base_templ_idx * nr_room_templ_variants) + ref.variant];
 
-    //
-    // "Down"
-    //
-    symbols.rotate_cw();
+    if (!variant_ptr)
+    {
+        variant_ptr.reset(new RoomTempl);
 
-    room_templates_.push_back(templ);
+        make_room_templ_variant(base_room_templates_[ref.base_templ_idx],
+                                ref.variant,
+                                *variant_ptr);
+    }
 
-    symbols.flip_hor();
+    return *variant_ptr;
+}
 
-    room_templates_.push_back(templ);
+void index_room_templ_variants()
+{
+    room_templ_variants_by_dims_.clear();
 
-    //
-    // "Left"
-    //
-    symbols.rotate_cw();
+    for (const auto& templ : base_room_templates_)
+    {
+        for (size_t variant = 0;
+             variant < nr_room_templ_variants;
+             ++variant)
+        {
+            RoomTemplVariantRef ref;
 
-    room_templates_.push_back(templ);
+            ref.dims = room_templ_variant_dims(templ.symbols.dims(), variant);
+            ref.base_templ_idx = templ.base_templ_idx;
+            ref.variant = variant;
 
-    symbols.flip_ver();
+            room_templ_variants_by_dims_.push_back(ref);
+        }
+    }
 
-    room_templates_.push_back(templ);
+    // NOTE: Variants of equal size are kept in template and variant order,
+    // so that the same seed always gives the same map
+    std::stable_sort(begin(room_templ_variants_by_dims_),
+                     end(room_templ_variants_by_dims_),
+                     [](const RoomTemplVariantRef& r1,
+                        const RoomTemplVariantRef& r2)
+    {
+        return
+            (r1.dims.x != r2.dims.x) ?
+            (r1.dims.x < r2.dims.x) :
+            (r1.dims.y < r2.dims.y);
+    });
 
-} // make_room_templ_variants
+    room_templ_variants_.clear();
 
+    room_templ_variants_.resize(
+        base_room_templates_.size() * nr_room_templ_variants);
+}
 
 void load_room_templates()
 {
     TRACE_FUNC_BEGIN;
 
-    room_templates_.clear();
+    base_room_templates_.clear();
 
     room_templ_status_.clear();
 
@@ -375,7 +453,8 @@ void load_room_templates()
 
             templ.base_templ_idx = current_base_templ_idx;
 
-            make_room_templ_variants(templ);
+            // NOTE: The symbols are resized for the next template anyway
+            base_room_templates_.push_back(std::move(templ));
 
             template_buffer.clear();
 
@@ -386,10 +465,12 @@ void load_room_templates()
 
     room_templ_status_.resize(current_base_templ_idx, RoomTemplStatus::unused);
 
+    index_room_templ_variants();
+
     TRACE << "Number of room templates loaded from template file: "
           << current_base_templ_idx
           << std::endl
-          << "Total variants: " << room_templates_.size()
+          << "Total variants: " << room_templ_variants_by_dims_.size()
           << std::endl;
 
     TRACE_FUNC_END;
@@ -441,25 +522,32 @@ const Array2<char>& level_templ(LevelTemplId id)
 
 RoomTempl* random_room_templ(const P& max_dims)
 {
-    ASSERT(!room_templates_.empty());
-
-    std::vector<RoomTempl*> bucket;
-
-    for (auto& templ : room_templates_)
+    ASSERT(!room_templ_variants_by_dims_.empty());
+
+    // The variants are sorted by width - only the variants up to the maximum
+    // width need to be considered
+    const auto variants_end =
+        std::upper_bound(
+            begin(room_templ_variants_by_dims_),
+            end(room_templ_variants_by_dims_),
+            max_dims.x,
+            [](const int w, const RoomTemplVariantRef& ref)
     {
-        const auto status = room_templ_status_[templ.base_templ_idx];
+        return w < ref.dims.x;
+    });
 
-        if (status != RoomTemplStatus::unused)
-        {
-            continue;
-        }
+    std::vector<const RoomTemplVariantRef*> bucket;
 
-        const P templ_dims(templ.symbols.dims());
+    for (auto it = begin(room_templ_variants_by_dims_);
+         it != variants_end;
+         ++it)
+    {
+        const auto status = room_templ_status_[it->base_templ_idx];
 
-        if (templ_dims.x <= max_dims.x &&
-            templ_dims.y <= max_dims.y)
+        if ((status == RoomTemplStatus::unused) &&
+            (it->dims.y <= max_dims.y))
         {
-            bucket.push_back(&templ);
+            bucket.push_back(&(*it));
         }
     }
 
@@ -476,7 +564,7 @@ RoomTempl* random_room_templ(const P& max_dims)
 
     const size_t idx = rnd::range(0, bucket.size() - 1);
 
-    return bucket[idx];
+    return &room_templ_variant(*bucket[idx]);
 }
 
 void clear_base_room_templates_used()
@@ -138,9 +138,38 @@ void go_to_nxt()
 {
         TRACE_FUNC_BEGIN;
 
+        // The level is built synchronously below, show what is going on
+        // instead of a black screen while waiting
         io::clear_screen();
+
+        io::draw_text_center(
+                "Descending...",
+                Panel::map,
+                P(map_w_half, map_h_half),
+                colors::gray());
+
         io::update_screen();
 
+        {
+                const auto& stats = draw_map::stats();
+
+                if (stats.nr_frames > 0)
+                {
+                        TRACE << "Map cells drawn on previous level: "
+                              << stats.nr_cells_drawn
+                              << " in "
+                              << stats.nr_frames
+                              << " frames ("
+                              << (stats.nr_cells_drawn / stats.nr_frames)
+                              << " per frame, out of "
+                              << (map_w * map_h)
+                              << ")"
+                              << std::endl;
+                }
+
+                draw_map::reset_stats();
+        }
+
         draw_map::clear();
 
         map_list.erase(map_list.begin());
@@ -1,8 +1,5 @@
 #include "mapgen.hpp"
 
-#include "map_parsing.hpp"
-#include "feature_rigid.hpp"
-
 #ifndef NDEBUG
 #include "init.hpp"
 #include "io.hpp"
@@ -16,6 +13,9 @@ void connect_rooms()
 {
         TRACE_FUNC_BEGIN;
 
+        // Updated by map::put as corridors are carved below
+        FreeCellConnectivity connectivity;
+
         int nr_tries_left = 5000;
 
         while (true)
@@ -135,27 +135,8 @@ void connect_rooms()
                                        *room1,
                                        door_proposals);
 
-                bool blocked[map_w][map_h];
-
-                map_parsers::BlocksMoveCommon(ParseActors::no).
-                        run(blocked);
-
-                // Do not consider doors blocking
-                for (int x = 0; x < map_w; ++x)
-                {
-                        for (int y = 0; y < map_h; ++y)
-                        {
-                                const auto id = map::cells[x][y].rigid->id();
-
-                                if (id == FeatureId::door)
-                                {
-                                        blocked[x][y] = false;
-                                }
-                        }
-                }
-
                 if ((nr_tries_left <= 2 || rnd::one_in(4)) &&
-                    map_parsers::is_map_connected(blocked))
+                    connectivity.is_all_connected())
                 {
                         break;
                 }
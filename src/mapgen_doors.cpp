@@ -140,8 +140,8 @@ void make_metal_doors_and_levers()
 
         for (const auto& chokepoint : map::choke_point_data)
         {
-            if (chokepoint.sides[0].empty() ||
-                chokepoint.sides[1].empty())
+            if (chokepoint.sides[0].none() ||
+                chokepoint.sides[1].none())
             {
                 continue;
             }
@@ -311,22 +311,27 @@ void make_metal_doors_and_levers()
                 }
             }
 
-            const auto& side_1 = chokepoint->sides[0];
-            const auto& side_2 = chokepoint->sides[1];
+            ASSERT(chokepoint->sides[0].any());
+            ASSERT(chokepoint->sides[1].any());
 
-            ASSERT(!side_1.empty());
-            ASSERT(!side_2.empty());
-
-            // Block side 2 positions for the side 1 lever
-            for (const auto& p : side_2)
+            for (int x = 0; x < map_w; ++x)
             {
-                blocks_lever_1[p.x][p.y] = true;
-            }
+                for (int y = 0; y < map_h; ++y)
+                {
+                    const P p(x, y);
 
-            // Block side 1 positions for the side 2 lever
-            for (const auto& p : side_1)
-            {
-                blocks_lever_2[p.x][p.y] = true;
+                    // Block side 2 positions for the side 1 lever
+                    if (chokepoint->is_on_side(1, p))
+                    {
+                        blocks_lever_1[x][y] = true;
+                    }
+
+                    // Block side 1 positions for the side 2 lever
+                    if (chokepoint->is_on_side(0, p))
+                    {
+                        blocks_lever_2[x][y] = true;
+                    }
+                }
             }
 
             std::vector<P> spawn_weight_positions_1;
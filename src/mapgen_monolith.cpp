@@ -79,7 +79,7 @@ void make_monoliths()
 
         const P p = spawn_weight_positions[spawn_p_idx];
 
-        map::cells[p.x][p.y].rigid = new Monolith(p);
+        map::put(new Monolith(p));
 
         // Block this position and all adjacent positions
         for (const P& d : dir_utils::cardinal_list_w_center)
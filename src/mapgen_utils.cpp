@@ -28,26 +28,163 @@ bool is_map_valid = true;
 
 bool door_proposals[map_w][map_h];
 
-bool is_all_rooms_connected()
+FreeCellConnectivity* active_connectivity = nullptr;
+
+// -----------------------------------------------------------------------------
+// FreeCellConnectivity
+// -----------------------------------------------------------------------------
+FreeCellConnectivity::FreeCellConnectivity() :
+    prev_active_(active_connectivity),
+    nr_sets_(0),
+    is_stale_(true)
+{
+    active_connectivity = this;
+}
+
+FreeCellConnectivity::~FreeCellConnectivity()
+{
+    ASSERT(active_connectivity == this);
+
+    active_connectivity = prev_active_;
+}
+
+void FreeCellConnectivity::on_rigid_put(const P& p)
+{
+    if (is_stale_)
+    {
+        return;
+    }
+
+    const int idx = pos_to_idx(p);
+
+    const bool is_free =
+        !map_parsers::BlocksMoveCommon(ParseActors::no).cell(p) ||
+        (map::cells[p.x][p.y].rigid->id() == FeatureId::door);
+
+    const bool was_free = parent_[idx] != -1;
+
+    if (is_free && !was_free)
+    {
+        add_free_cell(idx);
+
+        for (const P& d : dir_utils::dir_list)
+        {
+            const P adj_p(p + d);
+
+            if (map::is_pos_inside_map(adj_p) &&
+                (parent_[pos_to_idx(adj_p)] != -1))
+            {
+                unite(idx, pos_to_idx(adj_p));
+            }
+        }
+    }
+    else if (!is_free && was_free)
+    {
+        is_stale_ = true;
+    }
+}
+
+bool FreeCellConnectivity::is_all_connected()
+{
+    if (is_stale_)
+    {
+        rebuild();
+    }
+
+    return nr_sets_ <= 1;
+}
+
+void FreeCellConnectivity::rebuild()
 {
     bool blocked[map_w][map_h];
 
     map_parsers::BlocksMoveCommon(ParseActors::no)
         .run(blocked);
 
-    // Do not consider doors blocking
+    std::fill_n(parent_, nr_map_cells, -1);
+
+    nr_sets_ = 0;
+
     for (int x = 0; x < map_w; ++x)
     {
         for (int y = 0; y < map_h; ++y)
         {
-            if (map::cells[x][y].rigid->id() == FeatureId::door)
+            // Do not consider doors blocking
+            if (blocked[x][y] &&
+                (map::cells[x][y].rigid->id() != FeatureId::door))
             {
-                blocked[x][y] = false;
+                continue;
+            }
+
+            const P p(x, y);
+
+            const int idx = pos_to_idx(p);
+
+            add_free_cell(idx);
+
+            // Only the neighbours already visited need to be merged with
+            for (const P& d : {P(-1, -1), P(-1, 0), P(-1, 1), P(0, -1)})
+            {
+                const P adj_p(p + d);
+
+                if (map::is_pos_inside_map(adj_p) &&
+                    (parent_[pos_to_idx(adj_p)] != -1))
+                {
+                    unite(idx, pos_to_idx(adj_p));
+                }
             }
         }
     }
 
-    return map_parsers::is_map_connected(blocked);
+    is_stale_ = false;
+}
+
+void FreeCellConnectivity::add_free_cell(const int idx)
+{
+    parent_[idx] = idx;
+
+    ++nr_sets_;
+}
+
+int FreeCellConnectivity::find_root(int idx)
+{
+    while (parent_[idx] != idx)
+    {
+        // Path halving
+        parent_[idx] = parent_[parent_[idx]];
+
+        idx = parent_[idx];
+    }
+
+    return idx;
+}
+
+void FreeCellConnectivity::unite(const int idx_1, const int idx_2)
+{
+    const int root_1 = find_root(idx_1);
+    const int root_2 = find_root(idx_2);
+
+    if (root_1 != root_2)
+    {
+        parent_[root_2] = root_1;
+
+        --nr_sets_;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// mapgen
+// -----------------------------------------------------------------------------
+bool is_all_rooms_connected()
+{
+    if (active_connectivity)
+    {
+        return active_connectivity->is_all_connected();
+    }
+
+    FreeCellConnectivity connectivity;
+
+    return connectivity.is_all_connected();
 }
 
 // Adds the room to the room list and the room map
@@ -484,119 +621,276 @@ void valid_corridor_entries(const Room& room, std::vector<P>& out)
     TRACE_FUNC_END_VERBOSE;
 }
 
-bool is_choke_point(const P& p,
-                    const bool blocked[map_w][map_h],
-                    ChokePointData* out)
+void find_choke_points(const bool blocked[map_w][map_h],
+                       const bool candidates[map_w][map_h],
+                       std::vector<ChokePointData>& out)
 {
-    // Assuming that the tested position is free
-    ASSERT(!blocked[p.x][p.y]);
-
-    // Robustness for release mode
-    if (blocked[p.x][p.y])
+    // All choke points are articulation points of the graph of free cells
+    // (with eight-way movement, same as the floodfill). These are found with
+    // a single depth first search (Hopcroft-Tarjan), recording for each cell
+    // its discovery order, the end of its subtree in the discovery order, and
+    // its "low link" - the earliest discovered cell reachable from the subtree
+    // by one non-tree edge. Removing a cell splits off each child subtree
+    // whose low link does not reach above the removed cell.
+    const int unvisited = -1;
+
+    int disc[map_w][map_h];
+    int low[map_w][map_h];
+    int subtree_end[map_w][map_h];
+    int tree_root[map_w][map_h];
+    P parent[map_w][map_h];
+
+    std::fill_n(*disc, nr_map_cells, unvisited);
+
+    struct DfsFrame
     {
-        // This is weird, invalidate the map
-        is_map_valid = false;
+        P p;
+        size_t dir_idx;
+    };
 
-        return false;
-    }
+    // NOTE: The stack can never be deeper than the number of cells, so
+    // reserving this up front keeps references to the top frame valid
+    std::vector<DfsFrame> stack;
 
-    // First, there must be exactly two free cells cardinally adjacent to the
-    // tested position
-    P p_side1;
-    P p_side2;
+    stack.reserve(nr_map_cells);
 
-    for (const P& d : dir_utils::cardinal_list)
-    {
-        const P adj_p(p + d);
+    int nr_visited = 0;
 
-        if (!blocked[adj_p.x][adj_p.y])
+    for (int x = 0; x < map_w; ++x)
+    {
+        for (int y = 0; y < map_h; ++y)
         {
-            if (p_side1.x == 0)
-            {
-                p_side1 = adj_p;
-            }
-            else if (p_side2.x == 0)
+            if (blocked[x][y] || (disc[x][y] != unvisited))
             {
-                p_side2 = adj_p;
+                continue;
             }
-            else // Both p0 and p1 has already been set
+
+            const int root_disc = nr_visited;
+
+            disc[x][y] = low[x][y] = nr_visited++;
+            tree_root[x][y] = root_disc;
+            parent[x][y].set(-1, -1);
+
+            stack.push_back({P(x, y), 0});
+
+            while (!stack.empty())
             {
-                // This is not a choke point, bye!
-                return false;
+                DfsFrame& frame = stack.back();
+
+                const P p = frame.p;
+
+                if (frame.dir_idx == dir_utils::dir_list.size())
+                {
+                    // All neighbours visited, the subtree is finished
+                    subtree_end[p.x][p.y] = nr_visited;
+
+                    stack.pop_back();
+
+                    if (!stack.empty())
+                    {
+                        const P& par = stack.back().p;
+
+                        low[par.x][par.y] =
+                            std::min(low[par.x][par.y], low[p.x][p.y]);
+                    }
+
+                    continue;
+                }
+
+                const P adj_p(p + dir_utils::dir_list[frame.dir_idx]);
+
+                ++frame.dir_idx;
+
+                if (!map::is_pos_inside_map(adj_p) ||
+                    blocked[adj_p.x][adj_p.y])
+                {
+                    continue;
+                }
+
+                if (disc[adj_p.x][adj_p.y] == unvisited)
+                {
+                    disc[adj_p.x][adj_p.y] = low[adj_p.x][adj_p.y] =
+                        nr_visited++;
+
+                    tree_root[adj_p.x][adj_p.y] = root_disc;
+                    parent[adj_p.x][adj_p.y] = p;
+
+                    stack.push_back({adj_p, 0});
+                }
+                else if (adj_p != parent[p.x][p.y])
+                {
+                    low[p.x][p.y] =
+                        std::min(low[p.x][p.y], disc[adj_p.x][adj_p.y]);
+                }
             }
         }
     }
 
-    // OK, the position has exactly two free cardinally adjacent cells
+    // Identifies which part of the map a (free) position would belong to if
+    // the removed position was blocked - the discovery index of the split off
+    // child subtree containing the position, or -1 for the remaining part
+    auto part_after_removal = [&](const P& removed, const P& pos)
+    {
+        const int pos_disc = disc[pos.x][pos.y];
 
-    // Check that the two sides can reach each other
-    int flood_side1[map_w][map_h];
+        const bool is_in_subtree =
+            (pos_disc > disc[removed.x][removed.y]) &&
+            (pos_disc < subtree_end[removed.x][removed.y]);
 
-    floodfill(p_side1,
-              blocked,
-              flood_side1);
+        if (!is_in_subtree)
+        {
+            return -1;
+        }
 
-    if (flood_side1[p_side2.x][p_side2.y] == 0)
-    {
-        // The two sides were already separated from each other, nevermind
-        return false;
-    }
+        for (const P& d : dir_utils::dir_list)
+        {
+            const P child_p(removed + d);
 
-    // Check if this position can completely separate the two sides
-    bool blocked_cpy[map_w][map_h];
+            if (!map::is_pos_inside_map(child_p) ||
+                blocked[child_p.x][child_p.y] ||
+                (parent[child_p.x][child_p.y] != removed))
+            {
+                continue;
+            }
 
-    memcpy(blocked_cpy, blocked, nr_map_cells);
+            const int child_disc = disc[child_p.x][child_p.y];
 
-    blocked_cpy[p.x][p.y] = true;
+            if ((pos_disc >= child_disc) &&
+                (pos_disc < subtree_end[child_p.x][child_p.y]))
+            {
+                const bool is_split_off =
+                    (low[child_p.x][child_p.y] >=
+                     disc[removed.x][removed.y]);
 
-    // Do another floodfill from side 1
-    floodfill(p_side1, blocked_cpy, flood_side1);
+                return is_split_off ? child_disc : -1;
+            }
+        }
 
-    if (flood_side1[p_side2.x][p_side2.y] > 0)
-    {
-        // The two sides can still reach each other - not a choke point
-        return false;
-    }
+        ASSERT(false);
 
-    // OK, this is a "true" choke point, time to gather more information!
+        return -1;
+    };
 
-    if (out)
+    for (int x = 0; x < map_w; ++x)
     {
-        out->p = p;
-    }
-
-    int flood_side2[map_w][map_h];
+        for (int y = 0; y < map_h; ++y)
+        {
+            if (blocked[x][y] || !candidates[x][y])
+            {
+                continue;
+            }
 
-    // Do a floodfill from side 2
-    floodfill(p_side2, blocked_cpy, flood_side2);
+            const P p(x, y);
 
-    if (out)
-    {
-        // Prepare for at lease the worst case of push-backs
-        out->sides[0].reserve(nr_map_cells);
-        out->sides[1].reserve(nr_map_cells);
+            // There must be exactly two free cells cardinally adjacent to the
+            // tested position
+            P p_sides[2];
 
-        // Add the origin positions for both sides (they have flood value 0)
-        out->sides[0].push_back(p_side1);
-        out->sides[1].push_back(p_side2);
+            int nr_free_adj = 0;
 
-        for (int x = 0; x < map_w; ++x)
-        {
-            for (int y = 0; y < map_h; ++y)
+            for (const P& d : dir_utils::cardinal_list)
             {
-                if (flood_side1[x][y] > 0)
+                const P adj_p(p + d);
+
+                if (!blocked[adj_p.x][adj_p.y])
                 {
-                    ASSERT(flood_side2[x][y] == 0);
+                    if (nr_free_adj < 2)
+                    {
+                        p_sides[nr_free_adj] = adj_p;
+                    }
 
-                    out->sides[0].push_back(P(x, y));
+                    ++nr_free_adj;
                 }
-                else if (flood_side2[x][y] > 0)
+            }
+
+            if (nr_free_adj != 2)
+            {
+                continue;
+            }
+
+            // The two sides are both adjacent to the tested position, so they
+            // are connected through it - check if they are still connected
+            // with the tested position blocked
+            const int side_parts[2] =
+            {
+                part_after_removal(p, p_sides[0]),
+                part_after_removal(p, p_sides[1])
+            };
+
+            if (side_parts[0] == side_parts[1])
+            {
+                continue;
+            }
+
+            // OK, this is a "true" choke point, gather the sides
+            ChokePointData d;
+
+            d.p = p;
+
+            for (int side_x = 0; side_x < map_w; ++side_x)
+            {
+                for (int side_y = 0; side_y < map_h; ++side_y)
                 {
-                    out->sides[1].push_back(P(x, y));
+                    const P side_p(side_x, side_y);
+
+                    if (blocked[side_x][side_y] ||
+                        (side_p == p) ||
+                        (tree_root[side_x][side_y] != tree_root[x][y]))
+                    {
+                        continue;
+                    }
+
+                    const int part = part_after_removal(p, side_p);
+
+                    for (size_t side_idx = 0; side_idx < 2; ++side_idx)
+                    {
+                        if (part == side_parts[side_idx])
+                        {
+                            d.sides[side_idx].set(
+                                ChokePointData::cell_idx(side_p));
+                        }
+                    }
                 }
             }
+
+            out.push_back(d);
         }
     }
+}
+
+bool is_choke_point(const P& p,
+                    const bool blocked[map_w][map_h],
+                    ChokePointData* out)
+{
+    // Assuming that the tested position is free
+    ASSERT(!blocked[p.x][p.y]);
+
+    // Robustness for release mode
+    if (blocked[p.x][p.y])
+    {
+        // This is weird, invalidate the map
+        is_map_valid = false;
+
+        return false;
+    }
+
+    bool candidates[map_w][map_h] = {};
+
+    candidates[p.x][p.y] = true;
+
+    std::vector<ChokePointData> choke_points;
+
+    find_choke_points(blocked, candidates, choke_points);
+
+    if (choke_points.empty())
+    {
+        return false;
+    }
+
+    if (out)
+    {
+        *out = choke_points[0];
+    }
 
     return true;
 }
@@ -1008,8 +1302,8 @@ void make_explore_spawn_weights(const bool blocked[map_w][map_h],
                 (choke_point.player_side == 0) ?
                 1 : 0;
 
-            const auto& other_side_positions =
-                choke_point.sides[other_side_idx];
+            const int nr_other_side_cells =
+                choke_point.nr_cells_on_side(other_side_idx);
 
             //
             // NOTE: To avoid leaning heavily towards only putting stuff in big
@@ -1018,7 +1312,7 @@ void make_explore_spawn_weights(const bool blocked[map_w][map_h],
             //
 
             const int weight_div =
-                std::max(1, (int)other_side_positions.size() / 2);
+                std::max(1, nr_other_side_cells / 2);
 
             // Increase weight for being in an optional map branch
             int weight_inc =
@@ -1048,9 +1342,15 @@ void make_explore_spawn_weights(const bool blocked[map_w][map_h],
                 }
             }
 
-            for (const P& p : other_side_positions)
+            for (int x = 0; x < map_w; ++x)
             {
-                weight_map[p.x][p.y] += weight_inc;
+                for (int y = 0; y < map_h; ++y)
+                {
+                    if (choke_point.is_on_side(other_side_idx, P(x, y)))
+                    {
+                        weight_map[x][y] += weight_inc;
+                    }
+                }
             }
         }
     }
@@ -1244,6 +1544,20 @@ P make_stairs_at_random_pos()
 
     const P stairs_pos(pos_bucket[cell_idx]);
 
+    // The furthest cells are picked, so if the chosen cell was not reached by
+    // the flood fill, the stairs cannot be reached at all - reject the map now
+    // instead of after the expensive choke point and population steps
+    if ((flood[stairs_pos.x][stairs_pos.y] == 0) &&
+        (stairs_pos != map::player->pos))
+    {
+        TRACE << "Stairs position not reachable from player, "
+              << "discarding map" << std:: endl;
+
+        is_map_valid = false;
+
+        return P(-1, -1);
+    }
+
     TRACE << "Spawning stairs at chosen cell" << std:: endl;
     map::put(new Stairs(stairs_pos));
 
@@ -1,7 +1,10 @@
 #include "msg_log.hpp"
 
-#include <vector>
+#include <algorithm>
+#include <functional>
 #include <string>
+#include <unordered_set>
+#include <vector>
 
 #include "init.hpp"
 #include "io.hpp"
@@ -21,10 +24,88 @@ static size_t history_size_ = 0;
 
 static size_t history_count_ = 0;
 
+// The lines are overwritten in place when the ring wraps around, so the
+// memory of each line is reused
 static std::vector<Msg> history_[history_capacity_];
 
+// Each distinct message text, referenced by the messages (the elements of an
+// unordered set are never moved by inserting)
+static std::unordered_set<std::string> texts_;
+
+// When this many texts are stored, the texts which are no longer referenced
+// by any message are removed
+static size_t texts_compact_size_ = 0;
+
+static const size_t texts_compact_size_min_ = 1024;
+
 static const std::string more_str = "-More-";
 
+static void for_each_stored_msg(std::function<void(Msg&)> func)
+{
+        for (std::vector<Msg>& line : lines_)
+        {
+                for (Msg& msg : line)
+                {
+                        func(msg);
+                }
+        }
+
+        for (std::vector<Msg>& line : history_)
+        {
+                for (Msg& msg : line)
+                {
+                        func(msg);
+                }
+        }
+}
+
+static void compact_texts()
+{
+        std::unordered_set<std::string> texts_used;
+
+        for_each_stored_msg([&texts_used](Msg& msg)
+        {
+                const auto it = texts_used.insert(msg.text()).first;
+
+                msg.set_text(&(*it));
+        });
+
+        texts_.swap(texts_used);
+
+        texts_compact_size_ =
+                std::max(texts_compact_size_min_, texts_.size() * 2);
+}
+
+static const std::string* stored_text(const std::string& str)
+{
+        auto it = texts_.find(str);
+
+        if (it == std::end(texts_))
+        {
+                if (texts_.size() >= texts_compact_size_)
+                {
+                        compact_texts();
+                }
+
+                it = texts_.insert(str).first;
+        }
+
+        return &(*it);
+}
+
+static void add_to_history(const std::vector<Msg>& line)
+{
+        // NOTE: Assigning to the existing line keeps its memory
+        history_[history_count_ % history_capacity_] = line;
+
+        ++history_count_;
+
+        if (history_size_ < history_capacity_)
+        {
+                ++history_size_;
+        }
+}
+
 static int x_after_msg(const Msg* const msg)
 {
         if (!msg)
@@ -32,24 +113,23 @@ static int x_after_msg(const Msg* const msg)
                 return 0;
         }
 
-        std::string str = "";
-
-        msg->str_with_repeats(str);
-
-        return msg->x_pos_ + str.size() + 1;
+        return msg->x_pos_ + msg->len() + 1;
 }
 
 // Used by normal log and history viewer
 static void draw_line(const std::vector<Msg>& line, const int y_pos)
 {
+        std::string str = "";
+
         for (const Msg& msg : line)
         {
-                std::string str = "";
-
-                msg.str_with_repeats(str);
+                if (msg.nr_repeats() > 1)
+                {
+                        msg.str_with_repeats(str);
+                }
 
                 io::draw_text(
-                        str,
+                        (msg.nr_repeats() > 1) ? str : msg.text(),
                         Panel::log,
                         P(msg.x_pos_, y_pos),
                         msg.color_);
@@ -69,8 +149,17 @@ void init()
                 line.clear();
         }
 
+        for (std::vector<Msg>& line : history_)
+        {
+                line.clear();
+        }
+
         history_size_   = 0;
         history_count_  = 0;
+
+        texts_.clear();
+
+        texts_compact_size_ = texts_compact_size_min_;
 }
 
 void draw()
@@ -100,14 +189,7 @@ void clear()
                 if (!line.empty())
                 {
                         // Add cleared line to history
-                        history_[history_count_ % history_capacity_] = line;
-
-                        ++history_count_;
-
-                        if (history_size_ < history_capacity_)
-                        {
-                                ++history_size_;
-                        }
+                        add_to_history(line);
 
                         line.clear();
                 }
@@ -136,21 +218,16 @@ void add(const std::string& str,
         // If frenzied, change message
         if (map::player->has_prop(PropId::frenzied))
         {
-                std::string frenzied_str = str;
-
-                bool has_lower_case = false;
-
-                for (auto c : frenzied_str)
-                {
-                        if ((c >= 'a') &&
-                            (c <= 'z'))
-                        {
-                                has_lower_case = true;
-                                break;
-                        }
-                }
+                const bool has_lower_case =
+                        std::any_of(
+                                std::begin(str),
+                                std::end(str),
+                                [](const char c)
+                                {
+                                        return (c >= 'a') && (c <= 'z');
+                                });
 
-                const char last_msg_char = frenzied_str.back();
+                const char last_msg_char = str.back();
 
                 bool is_ended_by_punctuation =
                         (last_msg_char == '.') ||
@@ -159,7 +236,8 @@ void add(const std::string& str,
                 if (has_lower_case && is_ended_by_punctuation)
                 {
                         // Convert to upper case
-                        frenzied_str = text_format::all_to_upper(frenzied_str);
+                        std::string frenzied_str =
+                                text_format::all_to_upper(str);
 
                         // Do not put "!" if string contains "..."
                         if (frenzied_str.find("...") == std::string::npos)
@@ -192,22 +270,19 @@ void add(const std::string& str,
                 prev_msg = &lines_[current_line_nr].back();
         }
 
+        const std::string* const text = stored_text(str);
+
         bool is_repeated = false;
 
-        // Check if message is identical to previous
+        // Check if message is identical to previous (the texts are stored
+        // once, so it is enough to compare the addresses)
         if (add_more_prompt_on_msg == MorePromptOnMsg::no &&
-            prev_msg)
+            prev_msg &&
+            (&prev_msg->text() == text))
         {
-                std::string prev_str = "";
+                prev_msg->incr_repeat();
 
-                prev_msg->str_raw(prev_str);
-
-                if (prev_str.compare(str) == 0)
-                {
-                        prev_msg->incr_repeat();
-
-                        is_repeated = true;
-                }
+                is_repeated = true;
         }
 
         if (!is_repeated)
@@ -240,7 +315,7 @@ void add(const std::string& str,
                         x_pos = 0;
                 }
 
-                lines_[current_line_nr].push_back(Msg(str, color, x_pos));
+                lines_[current_line_nr].push_back(Msg(text, color, x_pos));
         }
 
         io::clear_screen();
@@ -310,13 +385,14 @@ void more_prompt()
 
 void add_line_to_history(const std::string& line_to_add)
 {
-        std::vector<Msg> history_line;
-
-        const Msg msg(line_to_add,
-                      colors::white(),
-                      0);
+        std::vector<Msg>& history_line =
+                history_[history_count_ % history_capacity_];
 
-        history_[history_count_ % history_capacity_] = {msg};
+        history_line.assign(
+                1,
+                Msg(stored_text(line_to_add),
+                    colors::white(),
+                    0));
 
         ++history_count_;
 
@@ -326,27 +402,16 @@ void add_line_to_history(const std::string& line_to_add)
         }
 }
 
-const std::vector< std::vector<Msg> > history()
+MsgHistory history()
 {
-        std::vector< std::vector<Msg> > ret;
-
-        ret.reserve(history_size_);
-
-        size_t start = 0;
-
-        if (history_count_ >= history_capacity_)
-        {
-                start = history_count_ - history_capacity_;
-        }
-
-        for (size_t i = start; i < history_count_; ++i)
-        {
-                const auto& line = history_[i % history_capacity_];
-
-                ret.push_back(line);
-        }
-
-        return ret;
+        const size_t first_idx =
+                (history_count_ - history_size_) % history_capacity_;
+
+        return MsgHistory(
+                history_,
+                history_capacity_,
+                first_idx,
+                history_size_);
 }
 
 } // msg_log
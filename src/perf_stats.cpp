@@ -0,0 +1,262 @@
+#include "perf_stats.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+
+#include "rl_utils.hpp"
+#include "game_time.hpp"
+#include "io.hpp"
+#include "panel.hpp"
+#include "text_format.hpp"
+
+// -----------------------------------------------------------------------------
+// Private
+// -----------------------------------------------------------------------------
+// Number of most recent turns used for the percentiles
+static const size_t nr_turns_in_window = 256;
+
+static const std::string log_path = "perf_stats.csv";
+
+static const std::string counter_names[(size_t)PerfCounter::END] = {
+        "tick",
+        "mon_act",
+        "update_fov",
+        "update_light_map",
+        "snd_emit",
+        "pathfind",
+        "draw_map",
+        "update_screen"
+};
+
+struct CounterStats
+{
+        // Totals for the turn currently running
+        int64_t turn_ns = 0;
+        int nr_calls_turn = 0;
+
+        // Totals of the previous turn
+        int64_t last_turn_ns = 0;
+        int nr_calls_last_turn = 0;
+
+        // Ring buffer of the most recent turn totals
+        int64_t window_ns[nr_turns_in_window] = {};
+
+        int64_t p50_ns = 0;
+        int64_t p95_ns = 0;
+        int64_t p99_ns = 0;
+        int64_t max_ns = 0;
+};
+
+static CounterStats counters_[(size_t)PerfCounter::END];
+
+static size_t nr_turns_recorded_ = 0;
+
+static std::ofstream log_;
+
+static void clear()
+{
+        for (auto& counter : counters_)
+        {
+                counter = CounterStats();
+        }
+
+        nr_turns_recorded_ = 0;
+}
+
+static void open_log()
+{
+        log_.open(log_path, std::ios::out | std::ios::trunc);
+
+        if (!log_.is_open())
+        {
+                TRACE_ERROR_RELEASE << "Failed to open " << log_path
+                                    << std::endl;
+
+                return;
+        }
+
+        log_ << "turn,actors,mobs";
+
+        for (const auto& name : counter_names)
+        {
+                log_ << "," << name << "_us," << name << "_calls";
+        }
+
+        log_ << std::endl;
+}
+
+static void log_turn()
+{
+        if (!log_.is_open())
+        {
+                return;
+        }
+
+        log_ << game_time::turn_nr()
+             << "," << game_time::actors.size()
+             << "," << game_time::mobs.size();
+
+        for (const auto& counter : counters_)
+        {
+                log_ << "," << (counter.last_turn_ns / 1000)
+                     << "," << counter.nr_calls_last_turn;
+        }
+
+        // NOTE: Not flushed here (the file is flushed when closed), to keep
+        // the logging itself out of the measurements
+        log_ << "\n";
+}
+
+static void update_percentiles(CounterStats& counter)
+{
+        const size_t nr_samples =
+                std::min(nr_turns_recorded_, nr_turns_in_window);
+
+        if (nr_samples == 0)
+        {
+                return;
+        }
+
+        int64_t sorted[nr_turns_in_window];
+
+        std::copy(counter.window_ns,
+                  counter.window_ns + nr_samples,
+                  sorted);
+
+        std::sort(sorted, sorted + nr_samples);
+
+        auto percentile = [&](const size_t pct) {
+                return sorted[((nr_samples - 1) * pct) / 100];
+        };
+
+        counter.p50_ns = percentile(50);
+        counter.p95_ns = percentile(95);
+        counter.p99_ns = percentile(99);
+        counter.max_ns = sorted[nr_samples - 1];
+}
+
+static std::string us_str(const int64_t ns)
+{
+        return text_format::pad_before_to(std::to_string(ns / 1000), 7);
+}
+
+// -----------------------------------------------------------------------------
+// perf_stats
+// -----------------------------------------------------------------------------
+namespace perf_stats
+{
+
+bool is_enabled = false;
+
+void toggle()
+{
+        is_enabled = !is_enabled;
+
+        if (is_enabled)
+        {
+                clear();
+
+                open_log();
+        }
+        else
+        {
+                log_.close();
+        }
+}
+
+void add(const PerfCounter counter, const int64_t duration_ns)
+{
+        auto& stats = counters_[(size_t)counter];
+
+        stats.turn_ns += duration_ns;
+
+        ++stats.nr_calls_turn;
+}
+
+void end_turn()
+{
+        if (!is_enabled)
+        {
+                return;
+        }
+
+        const size_t window_idx = nr_turns_recorded_ % nr_turns_in_window;
+
+        ++nr_turns_recorded_;
+
+        for (auto& counter : counters_)
+        {
+                counter.last_turn_ns = counter.turn_ns;
+                counter.nr_calls_last_turn = counter.nr_calls_turn;
+
+                counter.window_ns[window_idx] = counter.turn_ns;
+
+                counter.turn_ns = 0;
+                counter.nr_calls_turn = 0;
+
+                update_percentiles(counter);
+        }
+
+        log_turn();
+}
+
+void draw()
+{
+        if (!is_enabled)
+        {
+                return;
+        }
+
+        const size_t name_w = 17;
+
+        const std::string header =
+                text_format::pad_after_to("Turn stats (us)", name_w) +
+                "   last    p50    p95    p99    max  calls";
+
+        const int x0 = panels::get_x1(Panel::screen) - (int)header.size();
+
+        int y = panels::get_y0(Panel::map);
+
+        io::draw_text(header,
+                      Panel::screen,
+                      P(x0, y),
+                      colors::light_white());
+
+        ++y;
+
+        for (size_t i = 0; i < (size_t)PerfCounter::END; ++i)
+        {
+                const auto& counter = counters_[i];
+
+                const std::string line =
+                        text_format::pad_after_to(counter_names[i], name_w) +
+                        us_str(counter.last_turn_ns) +
+                        us_str(counter.p50_ns) +
+                        us_str(counter.p95_ns) +
+                        us_str(counter.p99_ns) +
+                        us_str(counter.max_ns) +
+                        text_format::pad_before_to(
+                                std::to_string(counter.nr_calls_last_turn),
+                                7);
+
+                io::draw_text(line,
+                              Panel::screen,
+                              P(x0, y),
+                              colors::white());
+
+                ++y;
+        }
+
+        const std::string counts_line =
+                "Actors: " + std::to_string(game_time::actors.size()) +
+                ", mobs: " + std::to_string(game_time::mobs.size()) +
+                ", turns measured: " + std::to_string(nr_turns_recorded_);
+
+        io::draw_text(counts_line,
+                      Panel::screen,
+                      P(x0, y),
+                      colors::white());
+}
+
+} // perf_stats
@@ -273,8 +273,7 @@ void PostmortemMenu::on_start()
                         "Last messages:",
                         color_heading));
 
-        const std::vector< std::vector<Msg> >& history =
-                msg_log::history();
+        const auto history = msg_log::history();
 
         int history_element =
                 std::max(0, (int)history.size() - 20);
@@ -1,6 +1,7 @@
 #include "property.hpp"
 
 #include <algorithm>
+#include <cstddef>
 
 #include "property_data.hpp"
 #include "property_factory.hpp"
@@ -20,12 +21,31 @@
 #include "knockback.hpp"
 #include "item_factory.hpp"
 
+// -----------------------------------------------------------------------------
+// Private
+// -----------------------------------------------------------------------------
+// In practice, most property classes get a free list of their own
+static BlockPool prop_pool_(64);
+
 // -----------------------------------------------------------------------------
 // Property base class
 // -----------------------------------------------------------------------------
+void* Prop::operator new(const size_t size)
+{
+        return prop_pool_.allocate(size);
+}
+
+// NOTE: Since the destructor is virtual, the size is the size of the dynamic
+// type, i.e. the same size which was requested when allocating
+void Prop::operator delete(void* const ptr, const size_t size)
+{
+        prop_pool_.free(ptr, size);
+}
+
 Prop::Prop(PropId id) :
         id_(id),
         data_(property_data::data[(size_t)id]),
+        hooks_(property_factory::hooks(id)),
         nr_turns_left_(data_.std_rnd_turns.roll()),
         duration_mode_(PropDurationMode::standard),
         owner_(nullptr),
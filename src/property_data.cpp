@@ -3,15 +3,22 @@
 // -----------------------------------------------------------------------------
 // Private
 // -----------------------------------------------------------------------------
-static void add(PropData& d)
+struct PropDataList
 {
-        property_data::data[(size_t)d.id] = d;
+        PropData data[(size_t)PropId::END];
+};
+
+static constexpr void add(PropDataList& list, PropData& d)
+{
+        list.data[(size_t)d.id] = d;
 
         d = PropData();
 }
 
-static void init_data_list()
+static constexpr PropDataList make_data_list()
 {
+        PropDataList list {};
+
         PropData d;
 
         d.id = PropId::r_phys;
@@ -26,7 +33,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_fire;
         d.std_rnd_turns = Range(50, 100);
@@ -40,7 +47,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_poison;
         d.std_rnd_turns = Range(50, 100);
@@ -54,7 +61,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_elec;
         d.std_rnd_turns = Range(50, 100);
@@ -68,7 +75,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_acid;
         d.std_rnd_turns = Range(50, 100);
@@ -82,7 +89,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_sleep;
         d.std_rnd_turns = Range(50, 100);
@@ -96,7 +103,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_fear;
         d.std_rnd_turns = Range(50, 100);
@@ -110,7 +117,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_slow;
         d.std_rnd_turns = Range(50, 100);
@@ -122,7 +129,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_conf;
         d.std_rnd_turns = Range(50, 100);
@@ -136,7 +143,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_disease;
         d.std_rnd_turns = Range(50, 100);
@@ -150,7 +157,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_blind;
         d.name = "Blindness resistance";
@@ -159,7 +166,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_para;
         d.name = "Paralysis resistance";
@@ -168,7 +175,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_breath;
         d.std_rnd_turns = Range(50, 100);
@@ -178,7 +185,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::r_spell;
         d.name = "Spell Resistance";
@@ -190,7 +197,7 @@ static void init_data_list()
         d.msg_end_mon = "is vulnerable to spells.";
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::light_sensitive;
         d.std_rnd_turns = Range(50, 100);
@@ -203,7 +210,7 @@ static void init_data_list()
         d.msg_end_mon = "no longer is vulnerable to light.";
         d.allow_display_turns = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::blind;
         d.std_rnd_turns = Range(20, 30);
@@ -218,7 +225,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::deaf;
         d.std_rnd_turns = Range(200, 300);
@@ -229,7 +236,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::fainted;
         d.std_rnd_turns = Range(100, 200);
@@ -245,7 +252,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::burning;
         d.std_rnd_turns = Range(6, 8);
@@ -265,7 +272,7 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::poisoned;
         d.std_rnd_turns = Range(40, 80);
@@ -282,7 +289,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::paralyzed;
         d.std_rnd_turns = Range(3, 5);
@@ -299,7 +306,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::terrified;
         d.std_rnd_turns = Range(20, 30);
@@ -318,7 +325,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::confused;
         d.std_rnd_turns = Range(80, 120);
@@ -337,7 +344,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::stunned;
         d.std_rnd_turns = Range(5, 9);
@@ -353,7 +360,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::slowed;
         d.std_rnd_turns = Range(16, 24);
@@ -370,7 +377,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::hasted;
         d.std_rnd_turns = Range(12, 16);
@@ -385,7 +392,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::clockwork_hasted;
         d.std_rnd_turns = Range(7, 11);
@@ -396,7 +403,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::summoned;
         d.std_rnd_turns = Range(40, 80);
@@ -404,7 +411,7 @@ static void init_data_list()
         d.name = "Summoned";
         d.descr = "Was magically summoned here";
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::flared;
         d.std_rnd_turns = Range(3, 4);
@@ -413,7 +420,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.update_vision_on_toggled = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::nailed;
         d.name = "Nailed";
@@ -425,7 +432,7 @@ static void init_data_list()
         d.is_making_mon_aware = true;
         d.allow_display_turns = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::wound;
         d.name = "Wounded";
@@ -439,7 +446,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::hp_sap;
         d.name = "Life Sapped";
@@ -453,7 +460,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::spi_sap;
         d.name = "Spirit Sapped";
@@ -467,7 +474,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::mind_sap;
         d.name = "Mind Sapped";
@@ -478,7 +485,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::infected;
         d.std_rnd_turns = Range(100, 100);
@@ -493,7 +500,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::diseased;
         d.std_rnd_turns = Range(50, 100);
@@ -510,7 +517,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::descend;
         d.std_rnd_turns = Range(20, 30);
@@ -521,7 +528,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::weakened;
         d.std_rnd_turns = Range(50, 100);
@@ -540,7 +547,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::frenzied;
         d.std_rnd_turns = Range(50, 100);
@@ -558,7 +565,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::blessed;
         d.std_rnd_turns = Range(400, 600);
@@ -572,7 +579,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::cursed;
         d.std_rnd_turns = Range(50, 100);
@@ -587,7 +594,7 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::entangled;
         d.name = "Entangled";
@@ -600,7 +607,7 @@ static void init_data_list()
         d.is_making_mon_aware = true;
         d.allow_display_turns = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::radiant;
         d.std_rnd_turns = Range(50, 100);
@@ -613,7 +620,7 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::invis;
         d.std_rnd_turns = Range(50, 100);
@@ -628,7 +635,7 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::cloaked;
         d.std_rnd_turns = Range(5, 7);
@@ -645,10 +652,10 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::recloaks;
-        add(d);
+        add(list, d);
 
         d.id = PropId::see_invis;
         d.std_rnd_turns = Range(50, 100);
@@ -663,7 +670,7 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::darkvision;
         d.std_rnd_turns = Range(50, 100);
@@ -671,7 +678,7 @@ static void init_data_list()
         d.update_vision_on_toggled = true;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::tele_ctrl;
         d.std_rnd_turns = Range(50, 100);
@@ -683,14 +690,14 @@ static void init_data_list()
         d.allow_display_turns = true;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::spell_reflect;
         d.std_rnd_turns = Range(50, 100);
         d.allow_display_turns = false;
         d.allow_test_on_bot = true;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::aiming;
         d.std_rnd_turns = Range(1, 1);
@@ -699,7 +706,7 @@ static void init_data_list()
         d.descr = "Increased range attack effectiveness";
         d.allow_display_turns = false;
         d.alignment = PropAlignment::good;
-        add(d);
+        add(list, d);
 
         d.id = PropId::conflict;
         d.name = "Conflicted";
@@ -711,46 +718,46 @@ static void init_data_list()
         d.is_making_mon_aware = true;
         d.allow_display_turns = false;
         d.alignment = PropAlignment::bad;
-        add(d);
+        add(list, d);
 
         d.id = PropId::vortex;
-        add(d);
+        add(list, d);
 
         d.id = PropId::explodes_on_death;
-        add(d);
+        add(list, d);
 
         d.id = PropId::splits_on_death;
-        add(d);
+        add(list, d);
 
         d.id = PropId::corpse_eater;
-        add(d);
+        add(list, d);
 
         d.id = PropId::teleports;
-        add(d);
+        add(list, d);
 
         d.id = PropId::corrupts_env_color;
-        add(d);
+        add(list, d);
 
         d.id = PropId::regenerates;
-        add(d);
+        add(list, d);
 
         d.id = PropId::corpse_rises;
-        add(d);
+        add(list, d);
 
         d.id = PropId::breeds;
-        add(d);
+        add(list, d);
 
         d.id = PropId::confuses_adjacent;
-        add(d);
+        add(list, d);
 
         d.id = PropId::speaks_curses;
-        add(d);
+        add(list, d);
 
         d.id = PropId::possessed_by_zuul;
-        add(d);
+        add(list, d);
 
         d.id = PropId::major_clapham_summon;
-        add(d);
+        add(list, d);
 
         d.id = PropId::flying;
         d.name_short = "Flying";
@@ -759,7 +766,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::ethereal;
         d.name_short = "Ethereal";
@@ -770,7 +777,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::ooze;
         d.name_short = "Ooze";
@@ -781,7 +788,7 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::burrowing;
         d.name_short = "Burrow";
@@ -790,44 +797,44 @@ static void init_data_list()
         d.allow_display_turns = false;
         d.allow_test_on_bot = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::waiting;
         d.std_rnd_turns = Range(1, 1);
         d.allow_display_turns = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::disabled_attack;
         d.std_rnd_turns = Range(1, 1);
         d.allow_display_turns = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::disabled_melee;
         d.std_rnd_turns = Range(1, 1);
         d.allow_display_turns = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
 
         d.id = PropId::disabled_ranged;
         d.std_rnd_turns = Range(1, 1);
         d.allow_display_turns = false;
         d.alignment = PropAlignment::neutral;
-        add(d);
+        add(list, d);
+
+        return list;
 }
 
+// NOTE: Built entirely at compile time, no initialization is needed
+static constexpr PropDataList data_list = make_data_list();
+
 // -----------------------------------------------------------------------------
 // property_data
 // -----------------------------------------------------------------------------
 namespace property_data
 {
 
-PropData data[(size_t)PropId::END];
-
-void init()
-{
-        init_data_list();
-}
+const PropData* const data = data_list.data;
 
 } // property_data
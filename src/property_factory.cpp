@@ -1,246 +1,319 @@
 #include "property_factory.hpp"
 
+#include <type_traits>
+
 #include "property.hpp"
 
-namespace property_factory
+// -----------------------------------------------------------------------------
+// Private
+// -----------------------------------------------------------------------------
+template<typename T>
+struct TypeTag
 {
-
-Prop* make(const PropId id)
+    typedef T Type;
+};
+
+// Calls the given function with a type tag of the property class which is used
+// for the given id - this is the only place mapping ids to classes
+template<typename Func>
+static auto visit_prop_type(const PropId id, Func func) ->
+    decltype(func(TypeTag<Prop>()))
 {
     ASSERT(id != PropId::END);
 
     switch (id)
     {
     case PropId::nailed:
-        return new PropNailed();
+        return func(TypeTag<PropNailed>());
 
     case PropId::wound:
-        return new PropWound();
+        return func(TypeTag<PropWound>());
 
     case PropId::blind:
-        return new PropBlind();
+        return func(TypeTag<PropBlind>());
 
     case PropId::deaf:
-        return new PropDeaf();
+        return func(TypeTag<PropDeaf>());
 
     case PropId::burning:
-        return new PropBurning();
+        return func(TypeTag<PropBurning>());
 
     case PropId::flared:
-        return new PropFlared();
+        return func(TypeTag<PropFlared>());
 
     case PropId::paralyzed:
-        return new PropParalyzed();
+        return func(TypeTag<PropParalyzed>());
 
     case PropId::terrified:
-        return new PropTerrified();
+        return func(TypeTag<PropTerrified>());
 
     case PropId::weakened:
-        return new PropWeakened();
+        return func(TypeTag<PropWeakened>());
 
     case PropId::confused:
-        return new PropConfused();
+        return func(TypeTag<PropConfused>());
 
     case PropId::stunned:
-        return new PropStunned();
+        return func(TypeTag<PropStunned>());
 
     case PropId::waiting:
-        return new PropWaiting();
+        return func(TypeTag<PropWaiting>());
 
     case PropId::slowed:
-        return new PropSlowed();
+        return func(TypeTag<PropSlowed>());
 
     case PropId::hasted:
-        return new PropHasted();
+        return func(TypeTag<PropHasted>());
 
     case PropId::clockwork_hasted:
-        return new PropClockworkHasted();
+        return func(TypeTag<PropClockworkHasted>());
 
     case PropId::summoned:
-        return new PropSummoned();
+        return func(TypeTag<PropSummoned>());
 
     case PropId::infected:
-        return new PropInfected();
+        return func(TypeTag<PropInfected>());
 
     case PropId::diseased:
-        return new PropDiseased();
+        return func(TypeTag<PropDiseased>());
 
     case PropId::descend:
-        return new PropDescend();
+        return func(TypeTag<PropDescend>());
 
     case PropId::poisoned:
-        return new PropPoisoned();
+        return func(TypeTag<PropPoisoned>());
 
     case PropId::fainted:
-        return new PropFainted();
+        return func(TypeTag<PropFainted>());
 
     case PropId::frenzied:
-        return new PropFrenzied();
+        return func(TypeTag<PropFrenzied>());
 
     case PropId::aiming:
-        return new PropAiming();
+        return func(TypeTag<PropAiming>());
 
     case PropId::disabled_attack:
-        return new PropDisabledAttack();
+        return func(TypeTag<PropDisabledAttack>());
 
     case PropId::disabled_melee:
-        return new PropDisabledMelee();
+        return func(TypeTag<PropDisabledMelee>());
 
     case PropId::disabled_ranged:
-        return new PropDisabledRanged();
+        return func(TypeTag<PropDisabledRanged>());
 
     case PropId::blessed:
-        return new PropBlessed();
+        return func(TypeTag<PropBlessed>());
 
     case PropId::cursed:
-        return new PropCursed();
+        return func(TypeTag<PropCursed>());
 
     case PropId::entangled:
-        return new PropEntangled();
+        return func(TypeTag<PropEntangled>());
 
     case PropId::r_acid:
-        return new PropRAcid();
+        return func(TypeTag<PropRAcid>());
 
     case PropId::r_conf:
-        return new PropRConf();
+        return func(TypeTag<PropRConf>());
 
     case PropId::r_breath:
-        return new PropRBreath();
+        return func(TypeTag<PropRBreath>());
 
     case PropId::r_elec:
-        return new PropRElec();
+        return func(TypeTag<PropRElec>());
 
     case PropId::r_fear:
-        return new PropRFear();
+        return func(TypeTag<PropRFear>());
 
     case PropId::r_slow:
-        return new PropRSlow();
+        return func(TypeTag<PropRSlow>());
 
     case PropId::r_phys:
-        return new PropRPhys();
+        return func(TypeTag<PropRPhys>());
 
     case PropId::r_fire:
-        return new PropRFire();
+        return func(TypeTag<PropRFire>());
 
     case PropId::r_spell:
-        return new PropRSpell();
+        return func(TypeTag<PropRSpell>());
 
     case PropId::r_poison:
-        return new PropRPoison();
+        return func(TypeTag<PropRPoison>());
 
     case PropId::r_sleep:
-        return new PropRSleep();
+        return func(TypeTag<PropRSleep>());
 
     case PropId::light_sensitive:
-        return new PropLgtSens();
+        return func(TypeTag<PropLgtSens>());
 
     case PropId::zuul_possess_priest:
-        return new PropZuulPossessPriest();
+        return func(TypeTag<PropZuulPossessPriest>());
 
     case PropId::possessed_by_zuul:
-        return new PropPossessedByZuul();
+        return func(TypeTag<PropPossessedByZuul>());
 
     case PropId::major_clapham_summon:
-        return new PropMajorClaphamSummon();
+        return func(TypeTag<PropMajorClaphamSummon>());
 
     case PropId::flying:
-        return new PropFlying();
+        return func(TypeTag<PropFlying>());
 
     case PropId::ethereal:
-        return new PropEthereal();
+        return func(TypeTag<PropEthereal>());
 
     case PropId::ooze:
-        return new PropOoze();
+        return func(TypeTag<PropOoze>());
 
     case PropId::burrowing:
-        return new PropBurrowing();
+        return func(TypeTag<PropBurrowing>());
 
     case PropId::radiant:
-        return new PropRadiant();
+        return func(TypeTag<PropRadiant>());
 
     case PropId::darkvision:
-        return new PropDarkvis();
+        return func(TypeTag<PropDarkvis>());
 
     case PropId::r_disease:
-        return new PropRDisease();
+        return func(TypeTag<PropRDisease>());
 
     case PropId::r_blind:
-        return new PropRBlind();
+        return func(TypeTag<PropRBlind>());
 
     case PropId::r_para:
-        return new PropRPara();
+        return func(TypeTag<PropRPara>());
 
     case PropId::tele_ctrl:
-        return new PropTeleControl();
+        return func(TypeTag<PropTeleControl>());
 
     case PropId::spell_reflect:
-        return new PropSpellReflect();
+        return func(TypeTag<PropSpellReflect>());
 
     case PropId::conflict:
-        return new PropConflict();
+        return func(TypeTag<PropConflict>());
 
     case PropId::vortex:
-        return new PropVortex();
+        return func(TypeTag<PropVortex>());
 
     case PropId::explodes_on_death:
-        return new PropExplodesOnDeath();
+        return func(TypeTag<PropExplodesOnDeath>());
 
     case PropId::splits_on_death:
-        return new PropSplitsOnDeath();
+        return func(TypeTag<PropSplitsOnDeath>());
 
     case PropId::corpse_eater:
-        return new PropCorpseEater();
+        return func(TypeTag<PropCorpseEater>());
 
     case PropId::teleports:
-        return new PropTeleports();
+        return func(TypeTag<PropTeleports>());
 
     case PropId::corrupts_env_color:
-        return new PropCorruptsEnvColor();
+        return func(TypeTag<PropCorruptsEnvColor>());
 
     case PropId::regenerates:
-        return new PropRegenerates();
+        return func(TypeTag<PropRegenerates>());
 
     case PropId::corpse_rises:
-        return new PropCorpseRises();
+        return func(TypeTag<PropCorpseRises>());
 
     case PropId::breeds:
-        return new PropBreeds();
+        return func(TypeTag<PropBreeds>());
 
     case PropId::confuses_adjacent:
-        return new PropConfusesAdjacent();
+        return func(TypeTag<PropConfusesAdjacent>());
 
     case PropId::speaks_curses:
-        return new PropSpeaksCurses();
+        return func(TypeTag<PropSpeaksCurses>());
 
     case PropId::spawns_zombie_parts_on_destroyed:
-        return new PropSpawnsZombiePartsOnDestroyed();
+        return func(TypeTag<PropSpawnsZombiePartsOnDestroyed>());
 
     case PropId::invis:
-        return new PropInvisible();
+        return func(TypeTag<PropInvisible>());
 
     case PropId::cloaked:
-        return new PropCloaked();
+        return func(TypeTag<PropCloaked>());
 
     case PropId::recloaks:
-        return new PropRecloaks();
+        return func(TypeTag<PropRecloaks>());
 
     case PropId::see_invis:
-        return new PropSeeInvis();
+        return func(TypeTag<PropSeeInvis>());
 
     case PropId::hp_sap:
-        return new PropHpSap();
+        return func(TypeTag<PropHpSap>());
 
     case PropId::spi_sap:
-        return new PropSpiSap();
+        return func(TypeTag<PropSpiSap>());
 
     case PropId::mind_sap:
-        return new PropMindSap();
+        return func(TypeTag<PropMindSap>());
 
     case PropId::END:
         break;
     }
 
-    return nullptr;
+    return decltype(func(TypeTag<Prop>()))();
+}
+
+// True if the property class overrides the given virtual hook of the base class
+// (naming an inherited member function gives a pointer to member of the base)
+#define IS_OVERRIDING(T, method) \
+    (!std::is_same<decltype(&T::method), decltype(&Prop::method)>::value)
+
+template<typename T>
+static PropHooks hooks_of_type()
+{
+    PropHooks hooks;
+
+    hooks[(size_t)PropHook::on_tick] = IS_OVERRIDING(T, on_tick);
+    hooks[(size_t)PropHook::on_std_turn] = IS_OVERRIDING(T, on_std_turn);
+    hooks[(size_t)PropHook::on_act] = IS_OVERRIDING(T, on_act);
+    hooks[(size_t)PropHook::is_finished] = IS_OVERRIDING(T, is_finished);
+
+    return hooks;
+}
+
+#undef IS_OVERRIDING
+
+struct PropHooksTable
+{
+    PropHooksTable()
+    {
+        for (size_t i = 0; i < (size_t)PropId::END; ++i)
+        {
+            hooks[i] = visit_prop_type(
+                (PropId)i,
+                [](auto tag) -> PropHooks
+                {
+                    return hooks_of_type<typename decltype(tag)::Type>();
+                });
+        }
+    }
+
+    PropHooks hooks[(size_t)PropId::END];
+};
+
+// -----------------------------------------------------------------------------
+// property_factory
+// -----------------------------------------------------------------------------
+namespace property_factory
+{
+
+Prop* make(const PropId id)
+{
+    return visit_prop_type(
+        id,
+        [](auto tag) -> Prop*
+        {
+            return new typename decltype(tag)::Type();
+        });
+}
+
+const PropHooks& hooks(const PropId id)
+{
+    static const PropHooksTable table;
+
+    return table.hooks[(size_t)id];
 }
 
 } // property_factory
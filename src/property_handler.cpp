@@ -20,6 +20,10 @@ PropHandler::PropHandler(Actor* owner) :
         std::fill(std::begin(prop_count_cache_),
                   std::end(prop_count_cache_),
                   0);
+
+        std::fill(std::begin(hook_count_cache_),
+                  std::end(hook_count_cache_),
+                  0);
 }
 
 void PropHandler::apply_natural_props_from_actor_data()
@@ -184,7 +188,7 @@ void PropHandler::apply(Prop* const prop,
         {
                 if (prop->should_update_vision_on_toggled())
                 {
-                        map::update_vision();
+                        map::request_vision_update();
                 }
 
                 print_start_msg(*prop);
@@ -199,7 +203,7 @@ void PropHandler::print_resist_msg(const Prop& prop)
 {
         if (owner_->is_player())
         {
-                const auto msg = prop.data_.msg_res_player;
+                const std::string msg = prop.data_.msg_res_player;
 
                 if (!msg.empty())
                 {
@@ -212,7 +216,7 @@ void PropHandler::print_resist_msg(const Prop& prop)
         {
                 if (map::player->can_see_actor(*owner_))
                 {
-                        const auto msg = prop.data_.msg_res_mon;
+                        const std::string msg = prop.data_.msg_res_mon;
 
                         if (!msg.empty())
                         {
@@ -230,7 +234,7 @@ void PropHandler::print_start_msg(const Prop& prop)
 {
         if (owner_->is_player())
         {
-                const auto msg = prop.data_.msg_start_player;
+                const std::string msg = prop.data_.msg_start_player;
 
                 if (!msg.empty())
                 {
@@ -246,7 +250,7 @@ void PropHandler::print_start_msg(const Prop& prop)
         {
                 if (map::player->can_see_actor(*owner_))
                 {
-                        const auto msg = prop.data_.msg_start_mon;
+                        const std::string msg = prop.data_.msg_start_mon;
 
                         if (!msg.empty())
                         {
@@ -366,6 +370,16 @@ void PropHandler::incr_prop_count(const PropId id)
 #endif // NDEBUG
 
         ++v;
+
+        const auto& hooks = property_factory::hooks(id);
+
+        for (size_t i = 0; i < (size_t)PropHook::END; ++i)
+        {
+                if (hooks[i])
+                {
+                        ++hook_count_cache_[i];
+                }
+        }
 }
 
 void PropHandler::decr_prop_count(const PropId id)
@@ -383,13 +397,23 @@ void PropHandler::decr_prop_count(const PropId id)
 #endif // NDEBUG
 
         --v;
+
+        const auto& hooks = property_factory::hooks(id);
+
+        for (size_t i = 0; i < (size_t)PropHook::END; ++i)
+        {
+                if (hooks[i])
+                {
+                        --hook_count_cache_[i];
+                }
+        }
 }
 
 void PropHandler::on_prop_end(Prop* const prop)
 {
         if (prop->should_update_vision_on_toggled())
         {
-                map::update_vision();
+                map::request_vision_update();
         }
 
         // Print end message if this is the last active property of this type
@@ -408,7 +432,7 @@ void PropHandler::on_prop_end(Prop* const prop)
                 // Not player
                 else if (map::player->can_see_actor(*owner_))
                 {
-                        const auto msg = prop->data_.msg_end_mon;
+                        const std::string msg = prop->data_.msg_end_mon;
 
                         if (!msg.empty())
                         {
@@ -507,7 +531,10 @@ void PropHandler::on_turn_begin()
                         mon->become_aware_player(false);
                 }
 
-                const auto prop_ended = prop->on_tick();
+                const auto prop_ended =
+                        prop->hooks_[(size_t)PropHook::on_tick] ?
+                        prop->on_tick() :
+                        PropEnded::no;
 
                 // NOTE: The property may have removed itself at this point, if
                 // so it signals this by returning 'PropEnded::yes'
@@ -526,7 +553,14 @@ void PropHandler::on_turn_end()
         {
                 Prop* prop = it->get();
 
-                if (prop->is_finished())
+                // NOTE: For properties not overriding "is_finished", the base
+                // class version is called directly (no virtual call)
+                const bool is_finished =
+                        prop->hooks_[(size_t)PropHook::is_finished] ?
+                        prop->is_finished() :
+                        prop->Prop::is_finished();
+
+                if (is_finished)
                 {
                         auto prop_moved = std::move(*it);
 
@@ -545,18 +579,38 @@ void PropHandler::on_turn_end()
 
 void PropHandler::on_std_turn()
 {
+        if (hook_count_cache_[(size_t)PropHook::on_std_turn] == 0)
+        {
+                return;
+        }
+
         for (auto& prop: props_)
         {
-                prop->on_std_turn();
+                if (prop->hooks_[(size_t)PropHook::on_std_turn])
+                {
+                        prop->on_std_turn();
+                }
         }
 }
 
 DidAction PropHandler::on_act()
 {
+        if (hook_count_cache_[(size_t)PropHook::on_act] == 0)
+        {
+                return DidAction::no;
+        }
+
         for (size_t i = 0; i < props_.size(); /* No increment */)
         {
                 Prop* prop = props_[i].get();
 
+                if (!prop->hooks_[(size_t)PropHook::on_act])
+                {
+                        ++i;
+
+                        continue;
+                }
+
                 const auto result = prop->on_act();
 
                 // NOTE: The property may have removed itself at this point, if
@@ -182,7 +182,10 @@ int number(const P& pos,
 
 void wait_for_msg_more()
 {
-    if (!is_inited_ || config::is_bot_playing())
+    // More prompts are dismissed automatically in turbo mode
+    if (!is_inited_ ||
+        config::is_bot_playing() ||
+        config::is_turbo_mode())
     {
         return;
     }
@@ -0,0 +1,237 @@
+#include "replay.hpp"
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "io.hpp"
+#include "rl_utils.hpp"
+
+// -----------------------------------------------------------------------------
+// Private
+// -----------------------------------------------------------------------------
+// "IARP" (IA Replay)
+static const uint32_t replay_magic = 0x50524149;
+
+static const uint32_t replay_version = 1;
+
+static const size_t header_size = 12;
+
+// Key (4 bytes) and modifier flags (1 byte)
+static const size_t input_size = 5;
+
+static const uint8_t flag_shift = 1 << 0;
+static const uint8_t flag_ctrl = 1 << 1;
+
+static std::ofstream record_file_;
+
+static std::vector<InputData> recorded_inputs_;
+
+static size_t input_idx_ = 0;
+
+static bool is_playing_ = false;
+
+static bool is_quit_requested_ = false;
+
+static ReplayEnd on_end_ = ReplayEnd::continue_live;
+
+static std::chrono::steady_clock::time_point play_start_;
+
+static void put_u32(char* const dst, const uint32_t v)
+{
+        for (int i = 0; i < 4; ++i)
+        {
+                dst[i] = (char)((v >> (i * 8)) & 0xFF);
+        }
+}
+
+static uint32_t get_u32(const char* const src)
+{
+        uint32_t v = 0;
+
+        for (int i = 0; i < 4; ++i)
+        {
+                v |= (uint32_t)(uint8_t)src[i] << (i * 8);
+        }
+
+        return v;
+}
+
+static void end_playing()
+{
+        is_playing_ = false;
+
+        const auto d = std::chrono::steady_clock::now() - play_start_;
+
+        const auto ms =
+                std::chrono::duration_cast<std::chrono::milliseconds>(d)
+                .count();
+
+        std::cout << "Replay finished: "
+                  << recorded_inputs_.size()
+                  << " inputs in "
+                  << ms
+                  << " ms"
+                  << std::endl;
+
+        recorded_inputs_.clear();
+
+        if (on_end_ == ReplayEnd::quit)
+        {
+                is_quit_requested_ = true;
+        }
+}
+
+// -----------------------------------------------------------------------------
+// replay
+// -----------------------------------------------------------------------------
+namespace replay
+{
+
+bool start_recording(const std::string& path, const uint32_t seed)
+{
+        record_file_.open(path,
+                          std::ios::out |
+                          std::ios::binary |
+                          std::ios::trunc);
+
+        if (!record_file_.is_open())
+        {
+                return false;
+        }
+
+        char header[header_size];
+
+        put_u32(header, replay_magic);
+        put_u32(header + 4, replay_version);
+        put_u32(header + 8, seed);
+
+        record_file_.write(header, header_size);
+
+        record_file_.flush();
+
+        return record_file_.good();
+}
+
+bool start_playing(const std::string& path, const ReplayEnd on_end)
+{
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (!file.is_open())
+        {
+                return false;
+        }
+
+        const std::string buffer((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+
+        if ((buffer.size() < header_size) ||
+            (get_u32(buffer.data()) != replay_magic) ||
+            (get_u32(buffer.data() + 4) != replay_version))
+        {
+                return false;
+        }
+
+        const uint32_t seed = get_u32(buffer.data() + 8);
+
+        recorded_inputs_.clear();
+
+        // NOTE: A partially written last input (e.g. if the game crashed while
+        // recording) is ignored
+        for (size_t pos = header_size;
+             (pos + input_size) <= buffer.size();
+             pos += input_size)
+        {
+                const int key = (int)get_u32(buffer.data() + pos);
+
+                const uint8_t flags = (uint8_t)buffer[pos + 4];
+
+                recorded_inputs_.push_back(
+                        InputData(key,
+                                  (flags & flag_shift) != 0,
+                                  (flags & flag_ctrl) != 0));
+        }
+
+        rnd::seed(seed);
+
+        input_idx_ = 0;
+
+        on_end_ = on_end;
+
+        is_playing_ = true;
+
+        play_start_ = std::chrono::steady_clock::now();
+
+        TRACE << "Playing replay with seed " << seed << " and "
+              << recorded_inputs_.size() << " inputs" << std::endl;
+
+        return true;
+}
+
+void cleanup()
+{
+        record_file_.close();
+
+        recorded_inputs_.clear();
+
+        is_playing_ = false;
+
+        is_quit_requested_ = false;
+}
+
+bool is_playing()
+{
+        return is_playing_;
+}
+
+bool is_quit_requested()
+{
+        return is_quit_requested_;
+}
+
+bool try_get_input(InputData& input)
+{
+        if (!is_playing_)
+        {
+                return false;
+        }
+
+        if (input_idx_ >= recorded_inputs_.size())
+        {
+                end_playing();
+
+                return false;
+        }
+
+        input = recorded_inputs_[input_idx_];
+
+        ++input_idx_;
+
+        return true;
+}
+
+void on_input(const InputData& input)
+{
+        if (!record_file_.is_open())
+        {
+                return;
+        }
+
+        char data[input_size];
+
+        put_u32(data, (uint32_t)input.key);
+
+        data[4] = (char)(
+                (input.is_shift_held ? flag_shift : 0) |
+                (input.is_ctrl_held ? flag_ctrl : 0));
+
+        record_file_.write(data, input_size);
+
+        // Flush every input, so that the recording is intact if the game
+        // crashes (which is when a recording is the most useful)
+        record_file_.flush();
+}
+
+} // replay
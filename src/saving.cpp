@@ -2,6 +2,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <sstream>
 
 #include "init.hpp"
 #include "msg_log.hpp"
@@ -43,6 +44,40 @@ State state_;
 
 std::vector<std::string> lines_;
 
+void save_rnd()
+{
+    for (size_t i = 0; i < (size_t)rnd::Stream::END; ++i)
+    {
+        const Rng& rng = rnd::stream_rng((rnd::Stream)i);
+
+        put_str(std::to_string(rng.state()));
+        put_str(std::to_string(rng.inc()));
+    }
+}
+
+// Same as "get_int", but for the 64 bit generator state
+uint64_t get_u64()
+{
+    uint64_t v = 0;
+
+    std::istringstream buffer(get_str());
+
+    buffer >> v;
+
+    return v;
+}
+
+void load_rnd()
+{
+    for (size_t i = 0; i < (size_t)rnd::Stream::END; ++i)
+    {
+        const uint64_t state = get_u64();
+        const uint64_t inc = get_u64();
+
+        rnd::stream_rng((rnd::Stream)i).set_state(state, inc);
+    }
+}
+
 void save_modules()
 {
     TRACE_FUNC_BEGIN;
@@ -66,6 +101,7 @@ void save_modules()
     game_time::save();
     player_spells::save();
     map_templates::save();
+    save_rnd();
 
     TRACE_FUNC_END;
 }
@@ -99,6 +135,7 @@ void load_modules()
     game_time::load();
     player_spells::load();
     map_templates::load();
+    load_rnd();
 
     TRACE_FUNC_END;
 }
@@ -159,6 +196,8 @@ void init()
 
 void save_game()
 {
+    PROFILE_SCOPE(__func__);
+
 #ifndef NDEBUG
     ASSERT(state_ == State::stopped);
     ASSERT(lines_.empty());
@@ -182,6 +221,8 @@ void save_game()
 
 void load_game()
 {
+    PROFILE_SCOPE(__func__);
+
 #ifndef NDEBUG
     ASSERT(state_ == State::stopped);
     ASSERT(lines_.empty());
@@ -8,6 +8,7 @@
 #include "init.hpp"
 #include "config.hpp"
 #include "game_time.hpp"
+#include "replay.hpp"
 
 namespace sdl_base
 {
@@ -79,10 +80,21 @@ void cleanup()
     SDL_Quit();
 }
 
+bool is_fast_forward()
+{
+    if (config::is_bot_playing() ||
+        config::is_turbo_mode() ||
+        replay::is_playing())
+    {
+        return true;
+    }
+
+    return is_inited && (SDL_GetModState() & KMOD_ALT);
+}
+
 void sleep(const Uint32 duration)
 {
-    if (is_inited &&
-        !config::is_bot_playing())
+    if (is_inited && !is_fast_forward())
     {
         if (duration == 1)
         {
@@ -95,6 +107,11 @@ void sleep(const Uint32 duration)
             while (SDL_GetTicks() < wait_until)
             {
                 SDL_PumpEvents();
+
+                if (is_fast_forward())
+                {
+                    break;
+                }
             }
         }
     }
@@ -2,6 +2,8 @@
 
 #include <iostream>
 #include <string>
+#include <vector>
+#include <cstring>
 
 #include "feature_rigid.hpp"
 #include "map.hpp"
@@ -9,6 +11,7 @@
 #include "actor_mon.hpp"
 #include "game_time.hpp"
 #include "map_parsing.hpp"
+#include "perf_stats.hpp"
 
 // -----------------------------------------------------------------------------
 // Sound
@@ -62,100 +65,278 @@ namespace
 
 int nr_snd_msg_printed_current_turn_;
 
-bool is_snd_heard_at_range(const int range, const Snd& snd)
+// Sounds waiting to be propagated to monsters (at the end of the atomic turn)
+std::vector<Snd> pending_snds_;
+
+// Cached sound blocking cells, rebuilt when the terrain revision changes
+bool blocked_[map_w][map_h];
+int blocked_terrain_revision_ = -1;
+
+// Cached distance field from the player, for testing if the player hears a
+// sound without flooding from the sound origin
+int player_flood_[map_w][map_h];
+P player_flood_origin_(-1, -1);
+int player_flood_terrain_revision_ = -1;
+
+int snd_max_dist(const Snd& snd)
 {
-    return range <= (snd.is_loud() ? snd_dist_loud : snd_dist_normal);
+    return snd.is_loud() ? snd_dist_loud : snd_dist_normal;
 }
 
-} // namespace
-
-void reset_nr_snd_msg_printed_current_turn()
+bool is_snd_heard_at_range(const int range, const Snd& snd)
 {
-    nr_snd_msg_printed_current_turn_ = 0;
+    return (range >= 0) && (range <= snd_max_dist(snd));
 }
 
-void run(Snd snd)
+void update_blocked()
 {
-    ASSERT(snd.msg() != " ");
+    const int terrain_revision = map::terrain_revision();
 
-    bool blocked[map_w][map_h];
+    if (blocked_terrain_revision_ != terrain_revision)
+    {
+        map_parsers::BlocksSound()
+            .run(blocked_);
 
-    map_parsers::BlocksSound()
-        .run(blocked);
+        blocked_terrain_revision_ = terrain_revision;
+    }
+}
 
-    const P& origin = snd.origin();
+// Floods from the origin, up to the given distance - cells which cannot be
+// reached within that distance are set to -1
+void flood_bounded(const P& origin,
+                   const int max_dist,
+                   int out[map_w][map_h])
+{
+    update_blocked();
+
+    bool blocked_cpy[map_w][map_h];
+
+    memcpy(blocked_cpy, blocked_, nr_map_cells);
 
     // Never block the origin - we want to be able to run the sound from e.g. a
     // closing door, after it was closed (and we don't want this to depend on
     // the floodfill algorithm, so we explicitly set the origin to free here)
-    blocked[origin.x][origin.y] = false;
-
-    int flood[map_w][map_h];
+    blocked_cpy[origin.x][origin.y] = false;
 
     floodfill(origin,
-              blocked,
-              flood,
-              999,
+              blocked_cpy,
+              out,
+              max_dist,
               P(-1, -1),
               true);
 
-    flood[origin.x][origin.y] = 0;
+    // The floodfill leaves unreached cells at zero
+    for (int x = 0; x < map_w; ++x)
+    {
+        for (int y = 0; y < map_h; ++y)
+        {
+            if (out[x][y] == 0)
+            {
+                out[x][y] = -1;
+            }
+        }
+    }
+
+    out[origin.x][origin.y] = 0;
+}
+
+// Distance from the sound origin to the player, or -1 if the origin cannot be
+// reached within the distance of a loud sound
+int dist_to_player(const P& origin)
+{
+    const P& player_pos = map::player->pos;
+
+    if (origin == player_pos)
+    {
+        return 0;
+    }
+
+    update_blocked();
+
+    const int terrain_revision = map::terrain_revision();
+
+    if ((player_flood_origin_ != player_pos) ||
+        (player_flood_terrain_revision_ != terrain_revision))
+    {
+        flood_bounded(player_pos, snd_dist_loud, player_flood_);
+
+        player_flood_origin_ = player_pos;
+
+        player_flood_terrain_revision_ = terrain_revision;
+    }
+
+    if (!blocked_[origin.x][origin.y])
+    {
+        return player_flood_[origin.x][origin.y];
+    }
+
+    // The origin blocks sound (e.g. a closed door), but the sound still
+    // travels from it - find the closest reached cell next to it
+    int dist = -1;
+
+    for (const P& d : dir_utils::dir_list)
+    {
+        const P p(origin + d);
+
+        const int adj_dist = player_flood_[p.x][p.y];
+
+        if ((adj_dist >= 0) &&
+            ((dist < 0) || ((adj_dist + 1) < dist)))
+        {
+            dist = adj_dist + 1;
+        }
+    }
+
+    return dist;
+}
+
+void run_player(Snd& snd)
+{
+    const P& origin = snd.origin();
+
+    const int dist = dist_to_player(origin);
+
+    if (!is_snd_heard_at_range(dist, snd))
+    {
+        return;
+    }
 
-    for (Actor* actor : game_time::actors)
+    const bool is_origin_seen_by_player =
+        map::cells[origin.x][origin.y].is_seen_by_player;
+
+    if (is_origin_seen_by_player &&
+        snd.is_msg_ignored_if_origin_seen())
     {
-        const int flood_val_at_actor = flood[actor->pos.x][actor->pos.y];
+        snd.clear_msg();
+    }
 
-        const bool is_origin_seen_by_player =
-            map::cells[origin.x][origin.y].is_seen_by_player;
+    const P& player_pos = map::player->pos;
 
-        if (!is_snd_heard_at_range(flood_val_at_actor, snd))
+    if (!snd.msg().empty())
+    {
+        // Add a direction to the message (i.e. "(NW)", "(E)" , etc)
+        if (player_pos != origin)
+        {
+            const std::string dir_str =
+                dir_utils::compass_dir_name(player_pos, origin);
+
+            snd.add_string("(" + dir_str + ")");
+        }
+    }
+
+    const int pct_dist = (dist * 100) / snd_max_dist(snd);
+
+    const P offset = (origin - player_pos).signs();
+
+    const Dir dir_to_origin = dir_utils::dir(offset);
+
+    map::player->hear_sound(snd,
+                            is_origin_seen_by_player,
+                            dir_to_origin,
+                            pct_dist);
+}
+
+void run_monsters(const std::vector<Snd>& snds)
+{
+    std::vector<bool> is_done(snds.size(), false);
+
+    int flood[map_w][map_h];
+
+    for (size_t i = 0; i < snds.size(); ++i)
+    {
+        if (is_done[i])
         {
             continue;
         }
 
-        if (actor->is_player())
+        const P origin = snds[i].origin();
+
+        // All sounds with the same origin share one flood, which must reach
+        // as far as the loudest of them
+        int max_dist = 0;
+
+        for (size_t j = i; j < snds.size(); ++j)
+        {
+            if (snds[j].origin() == origin)
+            {
+                max_dist = std::max(max_dist, snd_max_dist(snds[j]));
+            }
+        }
+
+        flood_bounded(origin, max_dist, flood);
+
+        for (size_t j = i; j < snds.size(); ++j)
         {
-            if (is_origin_seen_by_player &&
-                snd.is_msg_ignored_if_origin_seen())
+            const Snd& snd = snds[j];
+
+            if (snd.origin() != origin)
             {
-                snd.clear_msg();
+                continue;
             }
 
-            const P& player_pos = map::player->pos;
+            is_done[j] = true;
 
-            if (!snd.msg().empty())
+            for (Actor* actor : game_time::actors)
             {
-                // Add a direction to the message (i.e. "(NW)", "(E)" , etc)
-                if (player_pos != origin)
+                if (actor->is_player())
                 {
-                    const std::string dir_str =
-                            dir_utils::compass_dir_name(player_pos, origin);
+                    continue;
+                }
+
+                const int flood_val_at_actor =
+                    flood[actor->pos.x][actor->pos.y];
 
-                    snd.add_string("(" + dir_str + ")");
+                if (!is_snd_heard_at_range(flood_val_at_actor, snd))
+                {
+                    continue;
                 }
+
+                Mon* const mon = static_cast<Mon*>(actor);
+
+                mon->hear_sound(snd);
             }
+        }
+    }
+}
 
-            const int snd_max_dist =
-                snd.is_loud() ?
-                snd_dist_loud : snd_dist_normal;
+} // namespace
 
-            const int pct_dist = (flood_val_at_actor * 100) / snd_max_dist;
+void reset_nr_snd_msg_printed_current_turn()
+{
+    nr_snd_msg_printed_current_turn_ = 0;
+}
 
-            const P offset = (origin - player_pos).signs();
+void run(Snd snd)
+{
+    perf_stats::Measure perf_measure(PerfCounter::snd_emit);
 
-            const Dir dir_to_origin = dir_utils::dir(offset);
+    ASSERT(snd.msg() != " ");
 
-            map::player->hear_sound(snd,
-                                    is_origin_seen_by_player,
-                                    dir_to_origin, pct_dist);
-        }
-        else // Not player
-        {
-            Mon* const mon = static_cast<Mon*>(actor);
+    // The player hears the sound immediately, to keep messages and audio in
+    // sync with what is drawn
+    run_player(snd);
 
-            mon->hear_sound(snd);
-        }
+    pending_snds_.push_back(snd);
+}
+
+void run_pending_snds()
+{
+    perf_stats::Measure perf_measure(PerfCounter::snd_emit);
+
+    // NOTE: Monsters hearing a sound may cause new sounds to be emitted
+    while (!pending_snds_.empty())
+    {
+        std::vector<Snd> snds;
+
+        snds.swap(pending_snds_);
+
+        run_monsters(snds);
     }
 }
 
+void clear_pending_snds()
+{
+    pending_snds_.clear();
+}
+
 } // snd_emit
@@ -22,6 +22,7 @@
 #include "player_bon.hpp"
 #include "game.hpp"
 #include "explosion.hpp"
+#include "area_query.hpp"
 #include "text_format.hpp"
 #include "item_factory.hpp"
 #include "property.hpp"
@@ -1491,19 +1492,16 @@ void SpellSearching::run_effect(Actor* const caster,
 
     const int det_mon_multiplier = 20;
 
-    for (Actor* actor : game_time::actors)
+    for (Actor* actor : area_query::living_actors_within(caster->pos, range))
     {
-        const P& p = actor->pos;
-
-        if (!actor->is_player() &&
-            actor->is_alive() &&
-            (king_dist(caster->pos, p) <= range))
+        if (actor->is_player())
         {
-            static_cast<Mon*>(actor)->set_player_aware_of_me(
-                det_mon_multiplier);
-
-            positions_detected.push_back(p);
+            continue;
         }
+
+        static_cast<Mon*>(actor)->set_player_aware_of_me(det_mon_multiplier);
+
+        positions_detected.push_back(actor->pos);
     }
 
     if (positions_detected.empty())
@@ -3,37 +3,101 @@
 #include "init.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <list>
+#include <unordered_map>
 
 namespace
 {
 
-// Reads and removes the first word of the string.
-std::string read_and_remove_word(std::string& line)
+// A range of positions, e.g. of a word in the original string
+struct Span
 {
-    std::string str = "";
+    size_t begin;
+    size_t end;
+};
 
-    for (auto it = begin(line); it != end(line); /* No increment */)
+struct Layout
+{
+    // The words of the text, as ranges in the original string
+    std::vector<Span> words;
+
+    // The words placed on each line, as ranges in "words"
+    std::vector<Span> lines;
+};
+
+// Finds the lines of a wrapped text, in one pass over the string and without
+// modifying or copying it. The width of a line is counted with a single space
+// between each word, regardless of the spacing in the original string.
+Layout make_layout(const std::string& line, const size_t max_w)
+{
+    Layout layout;
+
+    const size_t size = line.size();
+
+    size_t line_w = 0;
+
+    size_t word_begin = line.find_first_not_of(' ');
+
+    while (word_begin != std::string::npos)
     {
-        const char current_char = *it;
+        size_t word_end = line.find(' ', word_begin);
+
+        if (word_end == std::string::npos)
+        {
+            word_end = size;
+        }
+
+        const size_t word_w = word_end - word_begin;
 
-        line.erase(it);
+        const size_t word_idx = layout.words.size();
 
-        if (current_char == ' ')
+        layout.words.push_back({word_begin, word_end});
+
+        // The first word on a line is always placed, even if it is longer than
+        // the maximum width
+        if (!layout.lines.empty() &&
+            ((line_w + 1 + word_w) <= max_w))
+        {
+            // The word fits on the current line (with a space before it)
+            layout.lines.back().end = word_idx + 1;
+
+            line_w += 1 + word_w;
+        }
+        else // Start a new line with this word
         {
-            break;
+            layout.lines.push_back({word_idx, word_idx + 1});
+
+            line_w = word_w;
         }
 
-        str += current_char;
+        word_begin =
+            (word_end < size) ?
+            line.find_first_not_of(' ', word_end) :
+            std::string::npos;
     }
 
-    return str;
+    return layout;
 }
 
-bool is_word_fit(const std::string& current_string,
-                 const std::string& word_to_fit,
-                 const size_t max_w)
+struct LayoutCacheEntry
+{
+    std::string text;
+    int max_w;
+    std::vector<std::string> lines;
+};
+
+// Most recently used first
+std::list<LayoutCacheEntry> layout_cache_;
+
+std::unordered_multimap<size_t, std::list<LayoutCacheEntry>::iterator>
+layout_cache_index_;
+
+const size_t layout_cache_max_size_ = 64;
+
+size_t layout_key(const std::string& text, const int max_w)
 {
-    return (current_string.size() + word_to_fit.size() + 1) <= max_w;
+    return std::hash<std::string>()(text) ^ ((size_t)max_w * 0x9e3779b9);
 }
 
 } // namespace
@@ -42,55 +106,92 @@ bool is_word_fit(const std::string& current_string,
 namespace text_format
 {
 
-std::vector<std::string> split(std::string line, const int max_w)
+std::vector<std::string> split(const std::string& line, const int max_w)
 {
     std::vector<std::string> result;
 
-    if (line.empty())
-    {
-        return result;
-    }
+    const Layout layout = make_layout(line, (size_t)std::max(0, max_w));
 
-    std::string current_word = read_and_remove_word(line);
+    result.reserve(layout.lines.size());
 
-    if (line.empty())
+    for (const Span& line_words : layout.lines)
     {
-        result = {current_word};
+        const Span& first = layout.words[line_words.begin];
+        const Span& last = layout.words[line_words.end - 1];
 
-        return result;
+        result.emplace_back();
+
+        std::string& str = result.back();
+
+        // Words are joined by a single space
+        str.reserve(last.end - first.begin);
+
+        for (size_t i = line_words.begin; i < line_words.end; ++i)
+        {
+            const Span& word = layout.words[i];
+
+            if (i != line_words.begin)
+            {
+                str += ' ';
+            }
+
+            str.append(line, word.begin, word.end - word.begin);
+        }
     }
 
-    result.resize(1);
+    return result;
+}
 
-    result[0] = "";
+const std::vector<std::string>& split_cached(const std::string& line,
+                                             const int max_w)
+{
+    const size_t key = layout_key(line, max_w);
 
-    size_t current_row_idx = 0;
+    const auto range = layout_cache_index_.equal_range(key);
 
-    while (!current_word.empty())
+    for (auto it = range.first; it != range.second; ++it)
     {
-        if (!is_word_fit(result[current_row_idx], current_word, max_w))
-        {
-            // Current word did not fit on current line, make a new line
-            ++current_row_idx;
+        const auto entry_it = it->second;
 
-            result.resize(current_row_idx + 1);
+        if ((entry_it->max_w == max_w) &&
+            (entry_it->text == line))
+        {
+            // Move to the front (most recently used)
+            layout_cache_.splice(begin(layout_cache_),
+                                 layout_cache_,
+                                 entry_it);
 
-            result[current_row_idx] = "";
+            return entry_it->lines;
         }
+    }
+
+    if (layout_cache_.size() >= layout_cache_max_size_)
+    {
+        // Evict the least recently used entry
+        const auto& oldest = layout_cache_.back();
+
+        const size_t oldest_key = layout_key(oldest.text, oldest.max_w);
 
-        // If this is not the first word on the current line, add a space before
-        // the word
-        if (!result[current_row_idx].empty())
+        const auto oldest_range = layout_cache_index_.equal_range(oldest_key);
+
+        for (auto it = oldest_range.first; it != oldest_range.second; ++it)
         {
-            result[current_row_idx] += " ";
-        }
+            if (it->second == std::prev(end(layout_cache_)))
+            {
+                layout_cache_index_.erase(it);
 
-        result[current_row_idx] += current_word;
+                break;
+            }
+        }
 
-        current_word = read_and_remove_word(line);
+        layout_cache_.pop_back();
     }
 
-    return result;
+    layout_cache_.push_front({line, max_w, split(line, max_w)});
+
+    layout_cache_index_.emplace(key, begin(layout_cache_));
+
+    return layout_cache_.front().lines;
 }
 
 std::vector<std::string> space_separated_list(const std::string& line)
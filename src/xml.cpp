@@ -2,18 +2,6 @@
 
 #include "rl_utils.hpp"
 
-// -----------------------------------------------------------------------------
-// Private
-// -----------------------------------------------------------------------------
-// In cases like getting an attribute or a child element, if the given name
-// string is empty, we should not call the tinyxml2 function with the c string
-// of the empty name string, but rather with a nullptr. Use this function to
-// convert std::string's to c strings, rather than std::string::c_str().
-static const char* to_c_str(const std::string str)
-{
-        return str.empty() ? nullptr : str.c_str();
-}
-
 // -----------------------------------------------------------------------------
 // xml
 // -----------------------------------------------------------------------------
@@ -44,19 +32,19 @@ Element* first_child(Doc& doc)
         return doc.FirstChildElement();
 }
 
-Element* first_child(Element* e, const std::string name)
+Element* first_child(Element* e, const char* const name)
 {
-        return e->FirstChildElement(to_c_str(name));
+        return e->FirstChildElement(name);
 }
 
-bool has_child(Element* e, const std::string name)
+bool has_child(Element* e, const char* const name)
 {
-        return e->FirstChildElement(to_c_str(name)) != nullptr;
+        return e->FirstChildElement(name) != nullptr;
 }
 
-Element* next_sibling(Element* e, const std::string name)
+Element* next_sibling(Element* e, const char* const name)
 {
-        return e->NextSiblingElement(to_c_str(name));
+        return e->NextSiblingElement(name);
 }
 
 std::string get_text_str(const Element* const e)
@@ -115,17 +103,17 @@ int get_text_int(const Element* const e)
         return value;
 }
 
-std::string get_attribute_str(const Element* const e, const std::string name)
+std::string get_attribute_str(const Element* const e, const char* const name)
 {
-        return e->Attribute(to_c_str(name));
+        return e->Attribute(name);
 }
 
-int get_attribute_int(const Element* const e, const std::string name)
+int get_attribute_int(const Element* const e, const char* const name)
 {
         int result = 0;
 
         const auto conv_result =
-                e->QueryAttribute(to_c_str(name),
+                e->QueryAttribute(name,
                                   &result);
 
         if (conv_result != tinyxml2::XML_SUCCESS)
@@ -146,10 +134,10 @@ int get_attribute_int(const Element* const e, const std::string name)
 }
 
 bool try_get_attribute_str(const Element* const e,
-                           const std::string name,
+                           const char* const name,
                            std::string& result)
 {
-        auto str = e->Attribute(name.c_str());
+        auto str = e->Attribute(name);
 
         if (str)
         {
@@ -162,19 +150,19 @@ bool try_get_attribute_str(const Element* const e,
 }
 
 bool try_get_attribute_int(const Element* const e,
-                           const std::string name,
+                           const char* const name,
                            int& result)
 {
-        auto conv_result = e->QueryAttribute(name.c_str(), &result);
+        auto conv_result = e->QueryAttribute(name, &result);
 
         return (conv_result == tinyxml2::XML_SUCCESS);
 }
 
 bool try_get_attribute_bool(const Element* const e,
-                            const std::string name,
+                            const char* const name,
                             bool& result)
 {
-        auto conv_result = e->QueryAttribute(name.c_str(), &result);
+        auto conv_result = e->QueryAttribute(name, &result);
 
         return (conv_result == tinyxml2::XML_SUCCESS);
 }
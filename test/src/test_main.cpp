@@ -16,6 +16,7 @@
 #include "item_factory.hpp"
 #include "text_format.hpp"
 #include "actor_factory.hpp"
+#include "actor_items.hpp"
 #include "actor_mon.hpp"
 #include "mapgen.hpp"
 #include "map_parsing.hpp"
@@ -26,11 +27,15 @@
 #include "player_spells.hpp"
 #include "player_bon.hpp"
 #include "explosion.hpp"
+#include "property.hpp"
+#include "area_query.hpp"
 #include "item_device.hpp"
 #include "feature_rigid.hpp"
+#include "feature_door.hpp"
 #include "feature_trap.hpp"
 #include "drop.hpp"
 #include "map_travel.hpp"
+#include "map_templates.hpp"
 
 struct BasicFixture
 {
@@ -39,11 +44,11 @@ struct BasicFixture
         init::init_game();
         init::init_session();
 
-        map::player->mk_start_items();
+        actor_items::make_for_actor(*map::player);
         map::player->pos = P(1, 1);
 
         // Because map generation is not run
-        map::reset_map();
+        map::reset();
     }
 
     ~BasicFixture()
@@ -105,6 +110,67 @@ TEST(2d_array)
     CHECK(a(2, 0) == 0);
 
     CHECK(a(0, 0) == 'x');
+
+    //
+    // Copy and move
+    //
+    Array2<char> copied(a);
+
+    CHECK(copied.dims() == P(3, 5));
+
+    CHECK(copied(0, 0) == 'x');
+
+    Array2<char> moved(std::move(copied));
+
+    CHECK(moved.dims() == P(3, 5));
+
+    CHECK(moved(0, 0) == 'x');
+
+    CHECK(copied.dims() == P(0, 0));
+
+    CHECK(!copied.data());
+
+    //
+    // Row major layout
+    //
+    Array2<int, Array2Layout::row_major> b(3, 2);
+
+    b.fill(0);
+
+    b(1, 0) = 1;
+
+    b(0, 1) = 2;
+
+    CHECK(b.data()[1] == 1);
+
+    CHECK(b.data()[3] == 2);
+
+    b.rotate_cw();
+
+    CHECK(b.dims() == P(2, 3));
+
+    CHECK(b(1, 1) == 1);
+
+    CHECK(b(0, 0) == 2);
+}
+
+TEST(block_pool)
+{
+    BlockPool pool(4);
+
+    // Blocks of a chunk are handed out in the order of their addresses
+    char* const a = static_cast<char*>(pool.allocate(20));
+    char* const b = static_cast<char*>(pool.allocate(20));
+
+    CHECK(b > a);
+
+    // A freed block is reused for the next object of the same block size
+    pool.free(b, 20);
+
+    CHECK(pool.allocate(24) == b);
+
+    pool.free(a, 20);
+    pool.free(b, 24);
 }
 
 TEST(is_val_in_range)
@@ -158,6 +224,49 @@ TEST(roll_dice)
     CHECK(val >= -1 && val <= 1);
 }
 
+TEST(rnd_streams)
+{
+    rnd::seed(1234);
+
+    int mapgen_val_1 = 0;
+
+    {
+        rnd::StreamScope rnd_stream(rnd::Stream::mapgen);
+
+        mapgen_val_1 = rnd::range(0, 1000000);
+    }
+
+    // Drawing numbers from another stream should not affect the mapgen stream
+    rnd::seed(1234);
+
+    rnd::range(0, 10);
+
+    {
+        rnd::StreamScope rnd_stream(rnd::Stream::cosmetic);
+
+        rnd::range(0, 10);
+    }
+
+    int mapgen_val_2 = 0;
+
+    {
+        rnd::StreamScope rnd_stream(rnd::Stream::mapgen);
+
+        mapgen_val_2 = rnd::range(0, 1000000);
+    }
+
+    CHECK_EQUAL(mapgen_val_1, mapgen_val_2);
+
+    // Restoring a saved state should repeat the same numbers
+    const Rng saved = rnd::rng();
+
+    const int val = rnd::range(0, 1000000);
+
+    rnd::rng().set_state(saved.state(), saved.inc());
+
+    CHECK_EQUAL(val, rnd::range(0, 1000000));
+}
+
 TEST(constrain_val_in_range)
 {
     int val = constr_in_range(5, 9, 10);
@@ -357,6 +466,31 @@ TEST(format_text)
     CHECK_EQUAL("345678",           formatted_lines[1]);
     CHECK_EQUAL(2, (int)formatted_lines.size());
 
+    lines_max_w    = 4;
+    str         = "123456 78";
+    formatted_lines = text_format::split(str, lines_max_w);
+    CHECK_EQUAL("123456",           formatted_lines[0]);
+    CHECK_EQUAL("78",               formatted_lines[1]);
+    CHECK_EQUAL(2, (int)formatted_lines.size());
+
+    // Repeated spaces do not end the text, and words are joined by a single
+    // space
+    lines_max_w    = 100;
+    str         = " one  two   three";
+    formatted_lines = text_format::split(str, lines_max_w);
+    CHECK_EQUAL("one two three",    formatted_lines[0]);
+    CHECK_EQUAL(1, (int)formatted_lines.size());
+
+    lines_max_w    = 7;
+    formatted_lines = text_format::split(str, lines_max_w);
+    CHECK_EQUAL("one two",          formatted_lines[0]);
+    CHECK_EQUAL("three",            formatted_lines[1]);
+    CHECK_EQUAL(2, (int)formatted_lines.size());
+
+    // The cached variant gives the same result
+    const auto& cached_lines = text_format::split_cached(str, lines_max_w);
+    CHECK(cached_lines == formatted_lines);
+
     str = "";
     formatted_lines = text_format::split(str, lines_max_w);
     CHECK(formatted_lines.empty());
@@ -735,6 +869,118 @@ TEST_FIXTURE(BasicFixture, explosions)
     CHECK(map::cells[x    ][y + 1].rigid->id() == FeatureId::wall);
 }
 
+TEST_FIXTURE(BasicFixture, area_queries)
+{
+    const P origin(10, 10);
+
+    bool blocked[map_w][map_h];
+
+    std::fill_n(*blocked, nr_map_cells, false);
+
+    // A wall two steps east of the origin, hiding the cell behind it
+    blocked[origin.x + 2][origin.y] = true;
+
+    const R area(origin - 3, origin + 3);
+
+    const auto cells = area_query::cells_in_los(area, origin, blocked);
+
+    CHECK_EQUAL(4, (int)cells.size());
+    CHECK_EQUAL(1, (int)cells[0].size());
+    CHECK(cells[0][0] == origin);
+    CHECK_EQUAL(8, (int)cells[1].size());
+
+    const auto& ring_3 = cells[3];
+
+    CHECK(std::find(begin(ring_3), end(ring_3), origin + P(3, 0)) ==
+          end(ring_3));
+
+    CHECK(std::find(begin(ring_3), end(ring_3), origin + P(-3, 0)) !=
+          end(ring_3));
+
+    // Living actors and corpses are found by position
+    map::put(new Floor(origin));
+
+    Actor* const corpse_1 = actor_factory::make(ActorId::rat, origin);
+    Actor* const corpse_2 = actor_factory::make(ActorId::rat, origin);
+
+    corpse_1->die(false, false, false);
+    corpse_2->die(false, false, false);
+
+    Actor* const rat = actor_factory::make(ActorId::rat, origin);
+
+    const ActorGrid grid;
+
+    CHECK(grid.living_actor(origin) == rat);
+    CHECK(!grid.living_actor(origin + 1));
+
+    std::vector<Actor*> corpses_found;
+
+    grid.for_each_corpse(origin, [&corpses_found](Actor* const corpse)
+    {
+        corpses_found.push_back(corpse);
+    });
+
+    CHECK_EQUAL(2, (int)corpses_found.size());
+    CHECK(corpses_found[0] == corpse_1);
+    CHECK(corpses_found[1] == corpse_2);
+
+    const auto near = area_query::living_actors_within(origin, 1);
+
+    CHECK(std::find(begin(near), end(near), rat) != end(near));
+    CHECK(std::find(begin(near), end(near), corpse_1) == end(near));
+}
+
+TEST(property_hooks_and_allocation)
+{
+    // Only the hooks actually overridden by a property class are flagged
+    const auto& recloaks_hooks = property_factory::hooks(PropId::recloaks);
+
+    CHECK(recloaks_hooks[(size_t)PropHook::on_act]);
+    CHECK(!recloaks_hooks[(size_t)PropHook::on_tick]);
+    CHECK(!recloaks_hooks[(size_t)PropHook::on_std_turn]);
+
+    const auto& blind_hooks = property_factory::hooks(PropId::blind);
+
+    CHECK(!blind_hooks[(size_t)PropHook::on_act]);
+    CHECK(!blind_hooks[(size_t)PropHook::on_std_turn]);
+
+    // A freed property block is reused for the next property of the same size
+    Prop* prop = new PropBlind();
+
+    const void* const block = prop;
+
+    delete prop;
+
+    prop = new PropBlind();
+
+    CHECK(prop == block);
+
+    delete prop;
+}
+
+TEST_FIXTURE(BasicFixture, props_allowing_move_through_rigids)
+{
+    const P p(5, 5);
+
+    map::put(new Wall(p));
+
+    const Rigid* const wall = map::cells[p.x][p.y].rigid;
+
+    Actor* const mon = actor_factory::make(ActorId::rat, P(4, 5));
+
+    CHECK(!wall->can_move(*mon));
+
+    // Properties not in the list of the feature do not allow moving (unused
+    // slots of the list must not be read as a property id)
+    mon->properties().apply(new PropRPhys());
+
+    CHECK(!wall->can_move(*mon));
+
+    mon->properties().apply(new PropEthereal());
+
+    CHECK(wall->can_move(*mon));
+}
+
 TEST_FIXTURE(BasicFixture, monster_stuck_in_spider_web)
 {
     // -----------------------------------------------------------------
@@ -1624,24 +1870,44 @@ TEST(find_choke_points)
 
     bool is_choke_point = mapgen::is_choke_point(P(21, 10),
                                                  blocked,
-                                                 d);
+                                                 &d);
 
     CHECK(is_choke_point);
 
     CHECK(d.p == P(21, 10));
 
-    CHECK(d.sides[0].size() == 1);
-    CHECK(d.sides[1].size() == 1);
+    CHECK(d.nr_cells_on_side(0) == 1);
+    CHECK(d.nr_cells_on_side(1) == 1);
+
+    CHECK(d.is_on_side(0, P(20, 10)));
+    CHECK(d.is_on_side(1, P(22, 10)));
+
+    CHECK(d.side_of(P(21, 10)) == -1);
+
+    // -------------------------------------------------------------------------
+    // Finding all choke points in one pass should give the same result
+    // -------------------------------------------------------------------------
+    bool candidates[map_w][map_h];
+
+    std::fill_n(*candidates, nr_map_cells, true);
+
+    std::vector<ChokePointData> choke_points;
+
+    mapgen::find_choke_points(blocked, candidates, choke_points);
 
-    CHECK(d.sides[0][0] == P(20, 10));
-    CHECK(d.sides[1][0] == P(22, 10));
+    CHECK(choke_points.size() == 1);
+
+    CHECK(choke_points[0].p == P(21, 10));
+
+    CHECK(choke_points[0].is_on_side(0, P(20, 10)));
+    CHECK(choke_points[0].is_on_side(1, P(22, 10)));
 
     // -------------------------------------------------------------------------
     // The left position should NOT be a choke point
     // -------------------------------------------------------------------------
     is_choke_point = mapgen::is_choke_point(P(20, 10),
                                             blocked,
-                                            d);
+                                            &d);
 
     CHECK(!is_choke_point);
 
@@ -1653,7 +1919,7 @@ TEST(find_choke_points)
 
     is_choke_point = mapgen::is_choke_point(P(21, 10),
                                             blocked,
-                                            d);
+                                            &d);
 
     CHECK(!is_choke_point);
 }
@@ -1705,6 +1971,108 @@ TEST_FIXTURE(BasicFixture, connect_rooms_with_corridor)
     delete room1;
 }
 
+// Reference for the connectivity tracking - checks the whole map with a flood
+// fill (doors are not considered blocking)
+bool is_map_connected_by_floodfill()
+{
+    bool blocked[map_w][map_h];
+
+    map_parsers::BlocksMoveCommon(ParseActors::no)
+        .run(blocked);
+
+    for (int x = 0; x < map_w; ++x)
+    {
+        for (int y = 0; y < map_h; ++y)
+        {
+            if (map::cells[x][y].rigid->id() == FeatureId::door)
+            {
+                blocked[x][y] = false;
+            }
+        }
+    }
+
+    return map_parsers::is_map_connected(blocked);
+}
+
+TEST_FIXTURE(BasicFixture, free_cell_connectivity)
+{
+    mapgen::FreeCellConnectivity connectivity;
+
+    // Two separate rooms
+    for (int x = 2; x <= 10; ++x)
+    {
+        for (int y = 2; y <= 10; ++y)
+        {
+            map::put(new Floor(P(x, y)));
+            map::put(new Floor(P(x + 20, y)));
+        }
+    }
+
+    CHECK(!connectivity.is_all_connected());
+    CHECK(!is_map_connected_by_floodfill());
+
+    // Connect the rooms with a corridor
+    for (int x = 11; x <= 21; ++x)
+    {
+        map::put(new Floor(P(x, 6)));
+
+        const bool is_connected = is_map_connected_by_floodfill();
+
+        CHECK_EQUAL(is_connected, connectivity.is_all_connected());
+    }
+
+    CHECK(connectivity.is_all_connected());
+
+    // Block the corridor
+    map::put(new Wall(P(15, 6)));
+
+    CHECK(!connectivity.is_all_connected());
+    CHECK(!is_map_connected_by_floodfill());
+
+    // Doors do not block
+    map::put(new Door(P(15, 6), nullptr, DoorType::gate));
+
+    CHECK(connectivity.is_all_connected());
+    CHECK(is_map_connected_by_floodfill());
+
+    // A mixed sequence of carving and blocking, checked after every change
+    for (int i = 0; i < 300; ++i)
+    {
+        const P p(2 + ((i * 7) % 30), 2 + ((i * 3) % 12));
+
+        if ((i % 3) == 0)
+        {
+            map::put(new Wall(p));
+        }
+        else
+        {
+            map::put(new Floor(p));
+        }
+
+        const bool is_connected = is_map_connected_by_floodfill();
+
+        CHECK_EQUAL(is_connected, connectivity.is_all_connected());
+    }
+}
+
+TEST_FIXTURE(BasicFixture, room_templates_fit_max_dims)
+{
+    for (int w = 1; w <= 20; ++w)
+    {
+        for (int h = 1; h <= 20; ++h)
+        {
+            const RoomTempl* const templ =
+                map_templates::random_room_templ(P(w, h));
+
+            if (templ)
+            {
+                CHECK(templ->symbols.dims().x <= w);
+                CHECK(templ->symbols.dims().y <= h);
+            }
+        }
+    }
+}
+
 TEST_FIXTURE(BasicFixture, map_parse_cells_within_dist_of_others)
 {
     bool in[map_w][map_h] = {};